@@ -1,3 +1,4 @@
+#include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/block_uniquer.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/stream.hpp>
@@ -28,6 +29,101 @@ TEST (ed25519, signing)
 	ASSERT_NE (0, valid2);
 }
 
+/*
+ * Adding a multiple of the group order to S gives a signature that single verification rejects, batch verification must reject it as well
+ */
+TEST (ed25519, batch_non_canonical_s)
+{
+	std::vector<nano::keypair> keys (8);
+	std::vector<nano::block_hash> hashes;
+	std::vector<nano::signature> signatures;
+	for (auto const & key : keys)
+	{
+		hashes.push_back (nano::random_pool::generate<nano::block_hash> ());
+		signatures.push_back (nano::sign_message (key.prv, key.pub, hashes.back ()));
+	}
+
+	// S + 2L, where L is the order of the base point
+	uint8_t const order_2[32] = { 0xda, 0xa7, 0xeb, 0xb9, 0x34, 0xc6, 0x24, 0xb0, 0xac, 0x39, 0xef, 0x45, 0xbd, 0xf3, 0xbd, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20 };
+	auto & malleated = signatures[3];
+	unsigned carry = 0;
+	for (size_t i = 0; i < 32; ++i)
+	{
+		carry += malleated.bytes[32 + i] + order_2[i];
+		malleated.bytes[32 + i] = static_cast<uint8_t> (carry);
+		carry >>= 8;
+	}
+	ASSERT_NE (0, malleated.bytes[63] & 0xe0);
+	ASSERT_TRUE (nano::validate_message (keys[3].pub, hashes[3], malleated));
+
+	std::vector<uint8_t const *> messages;
+	std::vector<size_t> lengths;
+	std::vector<uint8_t const *> public_keys;
+	std::vector<uint8_t const *> signature_data;
+	for (size_t i = 0; i < keys.size (); ++i)
+	{
+		messages.push_back (hashes[i].bytes.data ());
+		lengths.push_back (sizeof (nano::block_hash));
+		public_keys.push_back (keys[i].pub.bytes.data ());
+		signature_data.push_back (signatures[i].bytes.data ());
+	}
+	std::vector<int> valid (keys.size (), 0);
+	ASSERT_TRUE (nano::validate_message_batch (messages.data (), lengths.data (), public_keys.data (), signature_data.data (), keys.size (), valid.data ()));
+	for (size_t i = 0; i < keys.size (); ++i)
+	{
+		ASSERT_EQ (valid[i] == 0, nano::validate_message (keys[i].pub, hashes[i], signatures[i]));
+		ASSERT_EQ (valid[i] == 0, i == 3);
+	}
+}
+
+TEST (ed25519, batch_small_order_non_canonical_r)
+{
+	std::vector<nano::keypair> keys (8);
+	std::vector<nano::public_key> public_keys;
+	std::vector<nano::block_hash> hashes;
+	std::vector<nano::signature> signatures;
+	for (auto const & key : keys)
+	{
+		public_keys.push_back (key.pub);
+		hashes.push_back (nano::random_pool::generate<nano::block_hash> ());
+		signatures.push_back (nano::sign_message (key.prv, key.pub, hashes.back ()));
+	}
+
+	// Public key is the neutral element, R is the neutral element encoded as 2^255 - 18 and S is zero
+	// The batch decodes R modulo the field prime and accepts, single verification compares the canonical encoding and rejects
+	nano::public_key neutral{ 0 };
+	neutral.bytes[0] = 0x01;
+	nano::signature forged{ 0 };
+	std::fill (forged.bytes.begin (), forged.bytes.begin () + 32, 0xff);
+	forged.bytes[0] = 0xee;
+	forged.bytes[31] = 0x7f;
+	for (auto i : { 2, 5 })
+	{
+		public_keys[i] = neutral;
+		signatures[i] = forged;
+		ASSERT_TRUE (nano::validate_message (public_keys[i], hashes[i], signatures[i]));
+	}
+
+	std::vector<uint8_t const *> messages;
+	std::vector<size_t> lengths;
+	std::vector<uint8_t const *> public_key_data;
+	std::vector<uint8_t const *> signature_data;
+	for (size_t i = 0; i < keys.size (); ++i)
+	{
+		messages.push_back (hashes[i].bytes.data ());
+		lengths.push_back (sizeof (nano::block_hash));
+		public_key_data.push_back (public_keys[i].bytes.data ());
+		signature_data.push_back (signatures[i].bytes.data ());
+	}
+	std::vector<int> valid (keys.size (), 0);
+	ASSERT_TRUE (nano::validate_message_batch (messages.data (), lengths.data (), public_key_data.data (), signature_data.data (), keys.size (), valid.data ()));
+	for (size_t i = 0; i < keys.size (); ++i)
+	{
+		ASSERT_EQ (valid[i] == 0, nano::validate_message (public_keys[i], hashes[i], signatures[i]));
+		ASSERT_EQ (valid[i] == 0, i == 2 || i == 5);
+	}
+}
+
 TEST (transaction_block, empty)
 {
 	nano::keypair key1;
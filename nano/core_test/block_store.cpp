@@ -23,6 +23,8 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/property_tree/ptree.hpp>
+
 #include <cstdlib>
 #include <fstream>
 #include <unordered_set>
@@ -310,6 +312,40 @@ TEST (block_store, add_pending)
 	ASSERT_FALSE (store->pending.get (transaction, key2));
 }
 
+TEST (block_store, get_multiple)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	nano::account_info info1{ nano::block_hash (1), 1, nano::block_hash (1), 10, 100, 1, nano::epoch::epoch_0 };
+	nano::account_info info2{ nano::block_hash (2), 2, nano::block_hash (2), 20, 200, 2, nano::epoch::epoch_0 };
+	store->account.put (transaction, nano::account (5), info1);
+	store->account.put (transaction, nano::account (3), info2);
+	nano::pending_info pending1{ 1, 10, nano::epoch::epoch_0 };
+	store->pending.put (transaction, nano::pending_key (7, 2), pending1);
+	// Results are returned in request order, regardless of the key order in the table
+	auto accounts = store->account.get_multiple (transaction, { nano::account (5), nano::account (4), nano::account (3), nano::account (5) });
+	ASSERT_EQ (4, accounts.size ());
+	ASSERT_EQ (info1, accounts[0]);
+	ASSERT_FALSE (accounts[1]);
+	ASSERT_EQ (info2, accounts[2]);
+	ASSERT_EQ (info1, accounts[3]);
+	auto pending = store->pending.get_multiple (transaction, { nano::pending_key (7, 3), nano::pending_key (7, 2) });
+	ASSERT_EQ (2, pending.size ());
+	ASSERT_FALSE (pending[0]);
+	ASSERT_EQ (pending1, pending[1]);
+	auto block = std::make_shared<nano::open_block> (0, 1, 0, nano::keypair ().prv, 0, 0);
+	block->sideband_set ({});
+	store->block.put (transaction, block->hash (), *block);
+	auto blocks = store->block.get_multiple (transaction, { nano::block_hash (1), block->hash () });
+	ASSERT_EQ (2, blocks.size ());
+	ASSERT_EQ (nullptr, blocks[0]);
+	ASSERT_NE (nullptr, blocks[1]);
+	ASSERT_EQ (*block, *blocks[1]);
+	ASSERT_TRUE (store->account.get_multiple (transaction, {}).empty ());
+}
+
 TEST (block_store, pending_iterator)
 {
 	nano::logger logger;
@@ -1131,6 +1167,58 @@ TEST (mdb_block_store, sideband_height)
 	ASSERT_EQ (block12->sideband ().height, 1);
 }
 
+TEST (mdb_block_store, read_transaction_pool)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+	nano::logger logger;
+	nano::store::lmdb::component store (logger, nano::unique_path () / "data.ldb", nano::dev::constants);
+	ASSERT_FALSE (store.init_error ());
+	void * handle = nullptr;
+	{
+		auto transaction = store.tx_begin_read ();
+		handle = transaction.get_handle ();
+		ASSERT_EQ (store.version.get (transaction), store.version_current);
+	}
+	// The finished transaction is renewed instead of beginning a new one
+	{
+		auto transaction = store.tx_begin_read ();
+		ASSERT_EQ (handle, transaction.get_handle ());
+		ASSERT_EQ (store.version.get (transaction), store.version_current);
+	}
+	boost::property_tree::ptree json;
+	store.serialize_memory_stats (json);
+	ASSERT_LE (1, json.get<uint64_t> ("read_txn_renewals"));
+	ASSERT_EQ (1, json.get<uint64_t> ("read_txn_pooled"));
+}
+
+TEST (mdb_block_store, read_transaction_max_staleness)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+	nano::logger logger;
+	nano::lmdb_config config;
+	config.read_transaction_max_staleness = std::chrono::milliseconds{ 10 };
+	nano::store::lmdb::component store (logger, nano::unique_path () / "data.ldb", nano::dev::constants, nano::txn_tracking_config{}, std::chrono::seconds (5), config);
+	ASSERT_FALSE (store.init_error ());
+	{
+		auto transaction = store.tx_begin_read ();
+		std::this_thread::sleep_for (std::chrono::milliseconds{ 20 });
+		// Pooled or not, a reader does not keep its snapshot beyond the configured staleness
+		ASSERT_TRUE (transaction.refresh_if_needed ());
+		ASSERT_FALSE (transaction.refresh_if_needed ());
+	}
+	boost::property_tree::ptree json;
+	store.serialize_memory_stats (json);
+	ASSERT_EQ (1, json.get<uint64_t> ("read_txn_stale"));
+}
+
 TEST (block_store, peers)
 {
 	nano::logger logger;
@@ -1418,6 +1506,40 @@ TEST (mdb_block_store, upgrade_v23_v24)
 	// Testing the upgrade code worked
 	check_correct_state ();
 }
+
+TEST (mdb_block_store, upgrade_v24_v25)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Direct lmdb operations are used to simulate the old ledger format so this test will not work on RocksDB
+		GTEST_SKIP ();
+	}
+
+	auto path (nano::unique_path () / "data.ldb");
+	nano::logger logger;
+	auto const check_correct_state = [&] () {
+		nano::store::lmdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		ASSERT_EQ (store.version.get (transaction), store.version_current);
+		ASSERT_EQ (1, store.delegator.count (transaction));
+		ASSERT_TRUE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	};
+
+	// Testing current version contains the delegators index
+	check_correct_state ();
+
+	// Setting the database to its 24th version state
+	{
+		nano::store::lmdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		store.version.put (transaction, 24);
+		ASSERT_FALSE (mdb_drop (store.env.tx (transaction), store.delegator_store.delegators_handle, 0));
+		ASSERT_EQ (store.version.get (transaction), 24);
+	}
+
+	// Testing the upgrade rebuilt the index
+	check_correct_state ();
+}
 }
 
 namespace nano::store::rocksdb
@@ -5,6 +5,7 @@
 #include <nano/node/confirming_set.hpp>
 #include <nano/node/election.hpp>
 #include <nano/node/make_store.hpp>
+#include <nano/node/signature_checker.hpp>
 #include <nano/node/unchecked_map.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
@@ -27,6 +28,7 @@ struct confirming_set_context
 	nano::ledger & ledger;
 
 	nano::unchecked_map unchecked;
+	nano::signature_checker signature_checker;
 	nano::block_processor block_processor;
 	nano::confirming_set confirming_set;
 
@@ -35,7 +37,8 @@ struct confirming_set_context
 		stats{ ledger_context.stats () },
 		ledger{ ledger_context.ledger () },
 		unchecked{ 0, stats, false },
-		block_processor{ node_config, ledger, unchecked, stats, logger },
+		signature_checker{ 0, 0, stats },
+		block_processor{ node_config, ledger, unchecked, signature_checker, stats, logger },
 		confirming_set{ node_config.confirming_set, ledger, block_processor, stats, logger }
 	{
 	}
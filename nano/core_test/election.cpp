@@ -31,6 +31,39 @@ TEST (election, behavior)
 	ASSERT_EQ (nano::election_behavior::manual, election->behavior ());
 }
 
+TEST (election, tally_incremental)
+{
+	nano::test::system system (1);
+	auto & node = *system.nodes[0];
+	auto chain = nano::test::setup_chain (system, node, 1, nano::dev::genesis_key, false);
+	auto election = nano::test::start_election (system, node, chain[0]->hash ());
+	ASSERT_NE (nullptr, election);
+	auto const weight = node.ledger.weight (nano::dev::genesis_key.pub);
+	ASSERT_GT (weight, 0);
+
+	// Only the placeholder vote with zero weight for the initial block
+	auto tally = election->tally ();
+	ASSERT_EQ (1, tally.size ());
+	ASSERT_EQ (0, tally.begin ()->first);
+
+	election->set_last_vote (nano::dev::genesis_key.pub, { std::chrono::steady_clock::now (), 1, chain[0]->hash () });
+	tally = election->tally ();
+	ASSERT_EQ (1, tally.size ());
+	ASSERT_EQ (weight, tally.begin ()->first);
+
+	// Replacing the vote with one for an unknown block must remove its weight from the tally
+	election->set_last_vote (nano::dev::genesis_key.pub, { std::chrono::steady_clock::now (), 2, 1 });
+	tally = election->tally ();
+	ASSERT_EQ (1, tally.size ());
+	ASSERT_EQ (0, tally.begin ()->first);
+
+	// Switching back to the initial block as a final vote
+	election->set_last_vote (nano::dev::genesis_key.pub, { std::chrono::steady_clock::now (), std::numeric_limits<uint64_t>::max (), chain[0]->hash () });
+	tally = election->tally ();
+	ASSERT_EQ (1, tally.size ());
+	ASSERT_EQ (weight, tally.begin ()->first);
+}
+
 TEST (election, quorum_minimum_flip_success)
 {
 	nano::test::system system{};
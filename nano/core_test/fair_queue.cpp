@@ -1,3 +1,4 @@
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/node/transport/fake.hpp>
 #include <nano/test_common/system.hpp>
@@ -6,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <ranges>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -278,3 +280,136 @@ TEST (fair_queue, cleanup)
 	ASSERT_TRUE (queue.empty ());
 	ASSERT_EQ (queue.queues_size (), 2);
 }
+
+TEST (concurrent_fair_queue, max_queue_size)
+{
+	nano::concurrent_fair_queue<int, source_enum> queue;
+	queue.priority_query = [] (auto const &) { return 1; };
+	queue.max_size_query = [] (auto const &) { return 2; };
+
+	ASSERT_TRUE (queue.push (7, { source_enum::live }));
+	ASSERT_TRUE (queue.push (8, { source_enum::live }));
+	ASSERT_FALSE (queue.push (9, { source_enum::live }));
+	ASSERT_EQ (queue.size (), 2);
+	ASSERT_EQ (queue.queues_size (), 1);
+	ASSERT_EQ (queue.size ({ source_enum::live }), 2);
+
+	{
+		auto [result, origin] = queue.next ();
+		ASSERT_EQ (result, 7);
+		ASSERT_EQ (origin.source, source_enum::live);
+	}
+	{
+		auto [result, origin] = queue.next ();
+		ASSERT_EQ (result, 8);
+		ASSERT_EQ (origin.source, source_enum::live);
+	}
+
+	ASSERT_TRUE (queue.empty ());
+
+	// Space is reclaimed once requests are consumed
+	ASSERT_TRUE (queue.push (10, { source_enum::live }));
+	ASSERT_EQ (queue.next ().first, 10);
+}
+
+TEST (concurrent_fair_queue, round_robin_with_priority)
+{
+	nano::concurrent_fair_queue<int, source_enum> queue;
+	queue.priority_query = [] (auto const & origin) {
+		switch (origin.source)
+		{
+			case source_enum::live:
+				return 1;
+			case source_enum::bootstrap:
+				return 2;
+			case source_enum::unchecked:
+				return 3;
+			default:
+				return 0;
+		}
+	};
+	queue.max_size_query = [] (auto const &) { return 999; };
+
+	queue.push (7, { source_enum::live });
+	queue.push (8, { source_enum::live });
+	queue.push (9, { source_enum::live });
+	queue.push (10, { source_enum::bootstrap });
+	queue.push (11, { source_enum::bootstrap });
+	queue.push (12, { source_enum::bootstrap });
+	queue.push (13, { source_enum::unchecked });
+	queue.push (14, { source_enum::unchecked });
+	queue.push (15, { source_enum::unchecked });
+	ASSERT_EQ (queue.size (), 9);
+
+	// Same order as the non-concurrent fair_queue
+	auto batch = queue.next_batch (999);
+	ASSERT_EQ (batch.size (), 9);
+	std::vector<source_enum> sources;
+	for (auto const & [request, origin] : batch)
+	{
+		sources.push_back (origin.source);
+	}
+	std::vector<source_enum> expected{ source_enum::live, source_enum::bootstrap, source_enum::bootstrap, source_enum::unchecked, source_enum::unchecked, source_enum::unchecked, source_enum::live, source_enum::bootstrap, source_enum::live };
+	ASSERT_EQ (sources, expected);
+
+	ASSERT_TRUE (queue.empty ());
+}
+
+TEST (concurrent_fair_queue, concurrent)
+{
+	nano::concurrent_fair_queue<int, source_enum> queue;
+	queue.priority_query = [] (auto const &) { return 1; };
+	queue.max_size_query = [] (auto const &) { return 1024; };
+
+	size_t const producer_count = 4;
+	size_t const consumer_count = 4;
+	int const per_producer = 10000;
+
+	std::atomic<size_t> added{ 0 };
+	std::atomic<size_t> consumed{ 0 };
+	std::atomic<long long> sum{ 0 };
+	std::atomic<size_t> producers_done{ 0 };
+
+	std::vector<std::thread> threads;
+	for (size_t n = 0; n < producer_count; ++n)
+	{
+		threads.emplace_back ([&, n] () {
+			// Spread producers between two origins
+			auto const source = n % 2 == 0 ? source_enum::live : source_enum::bootstrap;
+			for (int i = 1; i <= per_producer; ++i)
+			{
+				while (!queue.push (i, { source }))
+				{
+					std::this_thread::yield ();
+				}
+				++added;
+			}
+			++producers_done;
+		});
+	}
+	for (size_t n = 0; n < consumer_count; ++n)
+	{
+		threads.emplace_back ([&] () {
+			while (producers_done < producer_count || !queue.empty ())
+			{
+				auto batch = queue.next_batch (64);
+				for (auto const & [request, origin] : batch)
+				{
+					sum += request;
+				}
+				consumed += batch.size ();
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+
+	ASSERT_EQ (added, producer_count * per_producer);
+	ASSERT_EQ (consumed, added);
+	ASSERT_EQ (sum, static_cast<long long> (producer_count) * per_producer * (per_producer + 1) / 2);
+	ASSERT_TRUE (queue.empty ());
+	ASSERT_EQ (queue.size ({ source_enum::live }), 0);
+	ASSERT_EQ (queue.size ({ source_enum::bootstrap }), 0);
+}
@@ -63,7 +63,9 @@ public:
 				result = res.str ();
 			}
 		});
-		ioc.run_one_for (deadline);
+		// Large messages are read by several handlers, run until the read completes
+		ioc.restart ();
+		ioc.run_for (deadline);
 		return result;
 	}
 
@@ -0,0 +1,120 @@
+#include <nano/lib/json_writer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST (json_writer, document)
+{
+	std::string output;
+	nano::json_writer writer{ [&output] (std::string const & data) {
+		output.append (data);
+		return true;
+	} };
+	writer.begin_object ();
+	writer.value ("action", "ledger");
+	writer.begin_object ("accounts");
+	writer.begin_object ("account1");
+	writer.value ("balance", "1");
+	writer.end_object ();
+	writer.begin_object ("account2");
+	writer.end_object ();
+	writer.end_object ();
+	writer.begin_array ("blocks");
+	writer.value ("hash1");
+	writer.value ("hash\"2\"");
+	writer.end_array ();
+	writer.end_object ();
+	ASSERT_TRUE (writer.finish ());
+	ASSERT_EQ (R"({"action":"ledger","accounts":{"account1":{"balance":"1"},"account2":""},"blocks":["hash1","hash\"2\""]})", output);
+
+	// The output must be readable by the property tree parser used by clients of the RPC
+	boost::property_tree::ptree tree;
+	std::stringstream stream (output);
+	boost::property_tree::read_json (stream, tree);
+	ASSERT_EQ ("1", tree.get<std::string> ("accounts.account1.balance"));
+	ASSERT_EQ (2, tree.get_child ("blocks").size ());
+	ASSERT_EQ ("hash\"2\"", tree.get_child ("blocks").back ().second.data ());
+}
+
+/** Empty containers are written like `boost::property_tree::write_json` writes an empty child */
+TEST (json_writer, empty)
+{
+	std::string output;
+	nano::json_writer writer{ [&output] (std::string const & data) {
+		output.append (data);
+		return true;
+	} };
+	writer.begin_object ();
+	writer.begin_array ("blocks");
+	writer.end_array ();
+	writer.begin_object ("accounts");
+	writer.begin_object ("account1");
+	writer.end_object ();
+	writer.end ();
+	writer.end ();
+	ASSERT_TRUE (writer.finish ());
+
+	boost::property_tree::ptree expected;
+	expected.add_child ("blocks", boost::property_tree::ptree{});
+	boost::property_tree::ptree accounts;
+	accounts.add_child ("account1", boost::property_tree::ptree{});
+	expected.add_child ("accounts", accounts);
+	std::stringstream expected_stream;
+	boost::property_tree::write_json (expected_stream, expected, false);
+	ASSERT_EQ (R"({"blocks":"","accounts":{"account1":""}})", output);
+	ASSERT_EQ (expected_stream.str (), output + "\n");
+}
+
+TEST (json_writer, chunks)
+{
+	std::vector<std::string> chunks;
+	nano::json_writer writer{ [&chunks] (std::string const & data) {
+		chunks.push_back (data);
+		return true;
+	},
+	16 };
+	writer.begin_array ();
+	for (auto i = 0; i < 100; ++i)
+	{
+		writer.value (std::to_string (i));
+	}
+	writer.end_array ();
+	// Output is flushed as soon as the chunk size is reached, instead of at the end
+	ASSERT_GT (chunks.size (), 10);
+	ASSERT_TRUE (writer.finish ());
+	std::string output;
+	for (auto const & chunk : chunks)
+	{
+		output.append (chunk);
+	}
+	ASSERT_EQ (output.size (), writer.flushed ());
+	boost::property_tree::ptree tree;
+	std::stringstream stream ("{\"values\":" + output + "}");
+	boost::property_tree::read_json (stream, tree);
+	ASSERT_EQ (100, tree.get_child ("values").size ());
+}
+
+TEST (json_writer, sink_rejected)
+{
+	size_t calls = 0;
+	nano::json_writer writer{ [&calls] (std::string const & data) {
+		++calls;
+		return false;
+	},
+	1 };
+	writer.begin_array ();
+	ASSERT_FALSE (writer.failed ());
+	writer.value ("a");
+	ASSERT_TRUE (writer.failed ());
+	writer.value ("b");
+	writer.end_array ();
+	ASSERT_FALSE (writer.finish ());
+	// Once rejected, no further output is passed to the sink
+	ASSERT_EQ (1, calls);
+}
@@ -1,4 +1,5 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/config.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/stats.hpp>
@@ -14,6 +15,7 @@
 #include <nano/secure/ledger_set_confirmed.hpp>
 #include <nano/secure/vote.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/version.hpp>
 #include <nano/test_common/ledger_context.hpp>
 #include <nano/test_common/make_store.hpp>
 #include <nano/test_common/system.hpp>
@@ -543,6 +545,40 @@ TEST (ledger, representative_change)
 	ASSERT_EQ (0, ledger.weight (key2.pub));
 }
 
+TEST (ledger, delegator_index)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto transaction = ledger.tx_begin_write ();
+	nano::keypair key2;
+	auto & pool = ctx.pool ();
+	ASSERT_TRUE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	ASSERT_EQ (1, store.delegator.count (transaction));
+	auto info1 = ledger.any.account_get (transaction, nano::dev::genesis_key.pub);
+	ASSERT_TRUE (info1);
+	nano::block_builder builder;
+	auto block = builder
+				 .change ()
+				 .previous (info1->head)
+				 .representative (key2.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (info1->head))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, block));
+	ASSERT_FALSE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	ASSERT_TRUE (store.delegator.exists (transaction, key2.pub, nano::dev::genesis_key.pub));
+	ASSERT_EQ (1, store.delegator.count (transaction));
+	auto i = store.delegator.begin (transaction, key2.pub);
+	ASSERT_NE (store.delegator.end (transaction), i);
+	ASSERT_EQ (key2.pub, i->first.uint256s[0]);
+	ASSERT_EQ (nano::dev::genesis_key.pub, i->first.uint256s[1]);
+	ASSERT_FALSE (ledger.rollback (transaction, block->hash ()));
+	ASSERT_TRUE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	ASSERT_FALSE (store.delegator.exists (transaction, key2.pub, nano::dev::genesis_key.pub));
+	ASSERT_EQ (1, store.delegator.count (transaction));
+}
+
 TEST (ledger, send_fork)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -685,6 +721,85 @@ TEST (ledger, representation_changes)
 	ASSERT_EQ (2, rep_weights.representation_get (key1.pub));
 }
 
+TEST (ledger, rep_weights_concurrent)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight };
+	// Enough representatives to replace the table a few times
+	size_t const count = nano::rep_weights::initial_capacity * 4;
+
+	std::atomic<bool> done{ false };
+	std::thread reader ([&] () {
+		while (!done)
+		{
+			// Weights only ever increase in this test
+			for (size_t i = 1; i <= count; i += 97)
+			{
+				auto weight = rep_weights.representation_get (i);
+				ASSERT_TRUE (weight == 0 || weight >= i);
+			}
+		}
+	});
+
+	for (size_t i = 1; i <= count; ++i)
+	{
+		rep_weights.representation_put (i, i);
+	}
+	for (size_t i = 1; i <= count; ++i)
+	{
+		rep_weights.representation_put (i, nano::uint128_t{ i } << 64);
+	}
+	done = true;
+	reader.join ();
+
+	ASSERT_EQ (count, rep_weights.size ());
+	ASSERT_EQ (count, rep_weights.get_rep_amounts ().size ());
+	for (size_t i = 1; i <= count; ++i)
+	{
+		ASSERT_EQ (nano::uint128_t{ i } << 64, rep_weights.representation_get (i));
+	}
+
+	// Representatives without weight are not counted
+	rep_weights.representation_put (1, 0);
+	ASSERT_EQ (count - 1, rep_weights.size ());
+	ASSERT_EQ (0, rep_weights.representation_get (1));
+	rep_weights.representation_put (1, 1);
+	ASSERT_EQ (count, rep_weights.size ());
+}
+
+/*
+ * Representatives that lose their weight must not make the table grow forever, replacement tables are sized for the representatives that still have weight
+ */
+TEST (ledger, rep_weights_capacity)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight };
+	auto capacity = [&rep_weights] () {
+		auto info = rep_weights.container_info ();
+		auto entry = std::find_if (info.entries ().begin (), info.entries ().end (), [] (auto const & entry) { return entry.name == "capacity"; });
+		release_assert (entry != info.entries ().end ());
+		return entry->size;
+	};
+
+	size_t const count = nano::rep_weights::initial_capacity;
+	size_t max_capacity = 0;
+	for (size_t round = 0; round < 16; ++round)
+	{
+		for (size_t i = 1; i <= count; ++i)
+		{
+			rep_weights.representation_put (round * count + i, i);
+		}
+		ASSERT_EQ (count, rep_weights.size ());
+		for (size_t i = 1; i <= count; ++i)
+		{
+			rep_weights.representation_put (round * count + i, 0);
+		}
+		ASSERT_EQ (0, rep_weights.size ());
+		max_capacity = std::max (max_capacity, capacity ());
+	}
+	ASSERT_LE (max_capacity, count * 8);
+}
+
 TEST (ledger, delete_rep_weight_of_zero)
 {
 	auto store{ nano::test::make_store () };
@@ -865,6 +980,225 @@ TEST (ledger, representation)
 	ASSERT_EQ (200, rep_weights.representation_get (key6.pub));
 }
 
+TEST (ledger, cache_snapshot)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	nano::stats stats{ logger };
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		auto transaction = ledger.tx_begin_write ();
+		store->initialize (transaction, ledger.cache, ledger.constants);
+	}
+
+	// Without a snapshot the counts are computed by scanning the ledger
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.block_count ());
+		ASSERT_EQ (1, ledger.account_count ());
+		ASSERT_EQ (1, ledger.cemented_count ());
+		ledger.cache_snapshot_put ();
+	}
+	{
+		auto transaction = store->tx_begin_read ();
+		auto snapshot = store->version.cache_get (transaction);
+		ASSERT_TRUE (snapshot);
+		ASSERT_EQ (1, snapshot->block_count);
+		ASSERT_EQ (1, snapshot->account_count);
+		ASSERT_EQ (1, snapshot->cemented_count);
+	}
+
+	auto make_snapshot = [&store] () {
+		auto transaction = store->tx_begin_read ();
+		nano::store::cache_snapshot snapshot;
+		snapshot.store_version = store->version.get (transaction);
+		snapshot.node_major_version = nano::get_major_node_version ();
+		snapshot.node_minor_version = nano::get_minor_node_version ();
+		return snapshot;
+	};
+
+	// Persisted counts are used instead of scanning the ledger
+	{
+		auto snapshot = make_snapshot ();
+		snapshot.block_count = 7;
+		snapshot.account_count = 3;
+		snapshot.cemented_count = 5;
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_put (transaction, snapshot);
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (7, ledger.block_count ());
+		ASSERT_EQ (3, ledger.account_count ());
+		ASSERT_EQ (5, ledger.cemented_count ());
+		// Snapshot is removed once the ledger is written to
+		ledger.tx_begin_write ();
+		auto transaction = store->tx_begin_read ();
+		ASSERT_FALSE (store->version.cache_get (transaction));
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.block_count ());
+		ASSERT_EQ (1, ledger.account_count ());
+		ASSERT_EQ (1, ledger.cemented_count ());
+	}
+
+	// Inconsistent snapshots are ignored
+	{
+		auto snapshot = make_snapshot ();
+		snapshot.block_count = 1;
+		snapshot.account_count = 2;
+		snapshot.cemented_count = 1;
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_put (transaction, snapshot);
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.account_count ());
+	}
+
+	// Snapshots that disagree with the ledger are ignored
+	{
+		auto snapshot = make_snapshot ();
+		snapshot.block_count = 7;
+		snapshot.account_count = 3;
+		snapshot.cemented_count = 5;
+		snapshot.pruned_count = 1;
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_put (transaction, snapshot);
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.block_count ());
+	}
+
+	// Snapshots taken by another node or store version are ignored
+	{
+		auto snapshot = make_snapshot ();
+		snapshot.block_count = 7;
+		snapshot.account_count = 3;
+		snapshot.cemented_count = 5;
+		snapshot.node_minor_version += 1;
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_put (transaction, snapshot);
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.block_count ());
+	}
+	{
+		auto snapshot = make_snapshot ();
+		snapshot.block_count = 7;
+		snapshot.account_count = 3;
+		snapshot.cemented_count = 5;
+		snapshot.store_version -= 1;
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_put (transaction, snapshot);
+	}
+	{
+		nano::ledger ledger (*store, stats, nano::dev::constants);
+		ASSERT_EQ (1, ledger.block_count ());
+	}
+
+	// Incomplete counts are not persisted
+	{
+		auto transaction = store->tx_begin_write ();
+		store->version.cache_del (transaction);
+	}
+	{
+		nano::generate_cache_flags flags;
+		flags.cemented_count = false;
+		nano::ledger ledger (*store, stats, nano::dev::constants, flags);
+		ledger.cache_snapshot_put ();
+		auto transaction = store->tx_begin_read ();
+		ASSERT_FALSE (store->version.cache_get (transaction));
+	}
+}
+
+TEST (ledger, cache_snapshot_serialization)
+{
+	nano::store::cache_snapshot snapshot;
+	snapshot.store_version = 25;
+	snapshot.node_major_version = 27;
+	snapshot.node_minor_version = 1;
+	snapshot.block_count = 7;
+	snapshot.account_count = 3;
+	snapshot.cemented_count = 5;
+	snapshot.pruned_count = 2;
+	auto data = snapshot.serialize ();
+
+	auto result = nano::store::cache_snapshot::deserialize (data.data (), data.size ());
+	ASSERT_TRUE (result);
+	ASSERT_EQ (25, result->store_version);
+	ASSERT_EQ (27, result->node_major_version);
+	ASSERT_EQ (1, result->node_minor_version);
+	ASSERT_EQ (7, result->block_count);
+	ASSERT_EQ (3, result->account_count);
+	ASSERT_EQ (5, result->cemented_count);
+	ASSERT_EQ (2, result->pruned_count);
+
+	// Truncated records
+	ASSERT_FALSE (nano::store::cache_snapshot::deserialize (data.data (), data.size () - 1));
+	ASSERT_FALSE (nano::store::cache_snapshot::deserialize (data.data (), 4));
+	// Corrupted records
+	auto corrupted = data;
+	corrupted[10] ^= 1;
+	ASSERT_FALSE (nano::store::cache_snapshot::deserialize (corrupted.data (), corrupted.size ()));
+	// Records of the previous format, four counts only
+	nano::uint256_union legacy;
+	legacy.qwords[0] = 7;
+	legacy.qwords[1] = 3;
+	legacy.qwords[2] = 5;
+	ASSERT_FALSE (nano::store::cache_snapshot::deserialize (legacy.bytes.data (), legacy.bytes.size ()));
+}
+
+TEST (ledger, block_cache)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & stats = ctx.stats ();
+	auto & pool = ctx.pool ();
+	auto transaction = ledger.tx_begin_write ();
+
+	// First lookup loads the block from the store, the second one is served from the cache
+	ledger.block_cache.clear ();
+	auto misses = stats.count (nano::stat::type::block_cache, nano::stat::detail::miss);
+	auto hits = stats.count (nano::stat::type::block_cache, nano::stat::detail::hit);
+	ASSERT_NE (nullptr, ledger.any.block_get (transaction, nano::dev::genesis->hash ()));
+	ASSERT_EQ (misses + 1, stats.count (nano::stat::type::block_cache, nano::stat::detail::miss));
+	auto genesis = ledger.any.block_get (transaction, nano::dev::genesis->hash ());
+	ASSERT_NE (nullptr, genesis);
+	ASSERT_EQ (hits + 1, stats.count (nano::stat::type::block_cache, nano::stat::detail::hit));
+	ASSERT_TRUE (genesis->sideband ().successor.is_zero ());
+
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (nano::dev::genesis_key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+
+	// The cached genesis block no longer matches the stored successor and is reloaded
+	genesis = ledger.any.block_get (transaction, nano::dev::genesis->hash ());
+	ASSERT_LE (1, stats.count (nano::stat::type::block_cache, nano::stat::detail::stale));
+	ASSERT_EQ (send->hash (), genesis->sideband ().successor);
+
+	// Rolled back blocks are removed from the cache
+	ASSERT_NE (nullptr, ledger.any.block_get (transaction, send->hash ()));
+	auto size = ledger.block_cache.size ();
+	ASSERT_FALSE (ledger.rollback (transaction, send->hash ()));
+	ASSERT_EQ (size - 1, ledger.block_cache.size ());
+	ASSERT_EQ (nullptr, ledger.any.block_get (transaction, send->hash ()));
+	ASSERT_TRUE (ledger.any.block_get (transaction, nano::dev::genesis->hash ())->sideband ().successor.is_zero ());
+}
+
 TEST (ledger, double_open)
 {
 	nano::logger logger;
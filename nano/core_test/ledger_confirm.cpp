@@ -7,6 +7,7 @@
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
+#include <nano/test_common/ledger_context.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
 
@@ -831,6 +832,134 @@ TEST (ledger_confirm, pruned_source)
 	ASSERT_TRUE (ledger.confirmed.block_exists (transaction, open2->hash ()));
 }
 
+TEST (ledger_confirm, plan)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & ledger = ctx.ledger ();
+	auto send = ctx.blocks ()[0];
+	auto receive = ctx.blocks ()[1];
+
+	std::unordered_set<nano::block_hash> planned;
+	std::deque<std::shared_ptr<nano::block>> plan;
+	{
+		auto transaction = ledger.tx_begin_read ();
+		plan = ledger.confirm_plan (transaction, receive->hash (), planned);
+		ASSERT_EQ (2, plan.size ());
+		ASSERT_EQ (send->hash (), plan[0]->hash ());
+		ASSERT_EQ (receive->hash (), plan[1]->hash ());
+		// Already planned blocks are not planned again
+		ASSERT_TRUE (ledger.confirm_plan (transaction, send->hash (), planned).empty ());
+		// Planning doesn't modify the ledger
+		ASSERT_FALSE (ledger.confirmed.block_exists (transaction, send->hash ()));
+	}
+
+	auto transaction = ledger.tx_begin_write ();
+	auto confirmed = ledger.confirm_planned (transaction, plan);
+	ASSERT_EQ (2, confirmed.size ());
+	ASSERT_TRUE (ledger.confirmed.block_exists (transaction, receive->hash ()));
+	ASSERT_EQ (3, ledger.cemented_count ());
+	auto info = ledger.store.confirmation_height.get (transaction, nano::dev::genesis_key.pub);
+	ASSERT_TRUE (info);
+	ASSERT_EQ (3, info->height);
+	ASSERT_EQ (receive->hash (), info->frontier);
+
+	// Applying the same plan again confirms nothing
+	ASSERT_TRUE (ledger.confirm_planned (transaction, plan).empty ());
+	ASSERT_EQ (3, ledger.cemented_count ());
+}
+
+TEST (ledger_confirm, plan_outdated)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & ledger = ctx.ledger ();
+	auto send = ctx.blocks ()[0];
+	auto receive = ctx.blocks ()[1];
+
+	std::unordered_set<nano::block_hash> planned;
+	auto plan = ledger.confirm_plan (ledger.tx_begin_read (), receive->hash (), planned);
+	ASSERT_EQ (2, plan.size ());
+
+	// Blocks rolled back after planning are not confirmed, neither is anything planned after them
+	auto transaction = ledger.tx_begin_write ();
+	ASSERT_FALSE (ledger.rollback (transaction, receive->hash ()));
+	auto confirmed = ledger.confirm_planned (transaction, plan);
+	ASSERT_EQ (1, confirmed.size ());
+	ASSERT_EQ (send->hash (), confirmed[0]->hash ());
+	ASSERT_FALSE (ledger.any.block_exists (transaction, receive->hash ()));
+	ASSERT_EQ (2, ledger.cemented_count ());
+	ASSERT_EQ (1, ctx.stats ().count (nano::stat::type::confirmation_height, nano::stat::detail::plan_invalid));
+}
+
+// Plans computed with a shared planned set omit dependencies listed by earlier plans, which might never be applied
+TEST (ledger_confirm, plan_dependency_unapplied)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & pool = ctx.pool ();
+	nano::keypair key;
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	auto send2 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2)
+				 .link (key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (send1->hash ()))
+				 .build ();
+	auto open = builder
+				.state ()
+				.account (key.pub)
+				.previous (0)
+				.representative (key.pub)
+				.balance (1)
+				.link (send1->hash ())
+				.sign (key.prv, key.pub)
+				.work (*pool.generate (key.pub))
+				.build ();
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send1));
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send2));
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, open));
+	}
+
+	std::unordered_set<nano::block_hash> planned;
+	std::deque<std::shared_ptr<nano::block>> plan1, plan2;
+	{
+		auto transaction = ledger.tx_begin_read ();
+		plan1 = ledger.confirm_plan (transaction, send2->hash (), planned);
+		plan2 = ledger.confirm_plan (transaction, open->hash (), planned);
+	}
+	ASSERT_EQ (2, plan1.size ());
+	ASSERT_EQ (1, plan2.size ());
+	ASSERT_EQ (open->hash (), plan2[0]->hash ());
+
+	// The target of the first plan is rolled back, so the first plan is never applied and send1 stays unconfirmed
+	auto transaction = ledger.tx_begin_write ();
+	ASSERT_FALSE (ledger.rollback (transaction, send2->hash ()));
+	ASSERT_TRUE (ledger.confirm_planned (transaction, plan2).empty ());
+	ASSERT_FALSE (ledger.confirmed.block_exists (transaction, open->hash ()));
+	ASSERT_EQ (1, ctx.stats ().count (nano::stat::type::confirmation_height, nano::stat::detail::plan_invalid));
+
+	// Regular cementing confirms the source first
+	auto confirmed = ledger.confirm (transaction, open->hash ());
+	ASSERT_EQ (2, confirmed.size ());
+	ASSERT_EQ (send1->hash (), confirmed[0]->hash ());
+	ASSERT_EQ (open->hash (), confirmed[1]->hash ());
+}
+
 // Test that if a block is marked to be confirmed that doesn't exist in the ledger the program aborts
 TEST (ledger_confirmDeathTest, rollback_added_block)
 {
@@ -26,13 +26,14 @@ auto message_deserializer_success_checker (message_type & message_original) -> v
 
 	// Message Deserializer with the query function tweaked to read from the `input_source`.
 	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
-	[&input_source, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
-		debug_assert (input_source.size () >= size_a);
-		data_a->resize (size_a);
+	[&input_source, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t buffer_offset_a, std::size_t min_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+		// Only deliver the minimum requested, so both header and payload reads are exercised
+		debug_assert (input_source.size () - offset >= min_size_a);
+		debug_assert (data_a->size () - buffer_offset_a >= min_size_a);
 		auto const copy_start = input_source.begin () + offset;
-		std::copy (copy_start, copy_start + size_a, data_a->data ());
-		offset += size_a;
-		callback_a (boost::system::errc::make_error_code (boost::system::errc::success), size_a);
+		std::copy (copy_start, copy_start + min_size_a, data_a->data () + buffer_offset_a);
+		offset += min_size_a;
+		callback_a (boost::system::errc::make_error_code (boost::system::errc::success), min_size_a);
 	});
 
 	// Generating the values for the `input_source`.
@@ -204,3 +205,55 @@ TEST (message_deserializer, exact_asc_pull_ack)
 
 	message_deserializer_success_checker<decltype (message)> (message);
 }
+
+// Multiple messages received with a single read are returned without further reads
+TEST (message_deserializer, batched_read)
+{
+	nano::network_filter filter (1024);
+	nano::block_uniquer block_uniquer;
+	nano::vote_uniquer vote_uniquer;
+
+	std::vector<uint8_t> input_source;
+	{
+		nano::vectorstream stream (input_source);
+		nano::keepalive keepalive{ nano::dev::network_params.network };
+		keepalive.serialize (stream);
+		nano::telemetry_req telemetry_req{ nano::dev::network_params.network };
+		telemetry_req.serialize (stream);
+		nano::frontier_req frontier_req{ nano::dev::network_params.network };
+		frontier_req.serialize (stream);
+	}
+	// Split the last message, so it needs to be completed with a second read
+	std::size_t const first_read = input_source.size () - 4;
+
+	std::size_t offset{ 0 };
+	std::size_t reads{ 0 };
+	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
+	[&] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t buffer_offset_a, std::size_t min_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+		auto const size = reads++ == 0 ? first_read : input_source.size () - offset;
+		EXPECT_GE (size, min_size_a);
+		std::copy (input_source.begin () + offset, input_source.begin () + offset + size, data_a->data () + buffer_offset_a);
+		offset += size;
+		callback_a (boost::system::errc::make_error_code (boost::system::errc::success), size);
+	});
+
+	std::vector<nano::message_type> received;
+	std::function<void (boost::system::error_code, std::unique_ptr<nano::message>)> callback;
+	callback = [&] (boost::system::error_code ec, std::unique_ptr<nano::message> message) {
+		ASSERT_FALSE (ec);
+		ASSERT_NE (nullptr, message);
+		received.push_back (message->type ());
+		if (received.size () < 3)
+		{
+			// Reading from within the callback must not recurse
+			message_deserializer->read (std::move (callback));
+		}
+	};
+	message_deserializer->read (std::move (callback));
+
+	ASSERT_EQ (3, received.size ());
+	ASSERT_EQ (nano::message_type::keepalive, received[0]);
+	ASSERT_EQ (nano::message_type::telemetry_req, received[1]);
+	ASSERT_EQ (nano::message_type::frontier_req, received[2]);
+	ASSERT_EQ (2, reads);
+}
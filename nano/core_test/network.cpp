@@ -205,6 +205,24 @@ TEST (network, send_discarded_publish)
 	ASSERT_EQ (nano::dev::genesis->hash (), node2.latest (nano::dev::genesis_key.pub));
 }
 
+// Flooded messages are serialized once and the same buffer is sent to all peers
+TEST (network, flood_serialize_once)
+{
+	nano::test::system system (3);
+	auto & node1 (*system.nodes[0]);
+	auto & node2 (*system.nodes[1]);
+	auto & node3 (*system.nodes[2]);
+	ASSERT_EQ (2, node1.network.size ());
+	nano::publish message{ nano::dev::network_params.network, nano::dev::genesis };
+	auto const size = message.to_bytes ()->size ();
+	node1.network.flood_message (message, nano::transport::traffic_type::test);
+	ASSERT_EQ (1, node1.stats.count (nano::stat::type::network, nano::stat::detail::flood, nano::stat::dir::out));
+	ASSERT_EQ (size, node1.stats.count (nano::stat::type::network, nano::stat::detail::flood_bytes_serialized, nano::stat::dir::out));
+	ASSERT_EQ (2 * size, node1.stats.count (nano::stat::type::network, nano::stat::detail::flood_bytes_sent, nano::stat::dir::out));
+	ASSERT_TIMELY (5s, node2.stats.count (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::in) != 0);
+	ASSERT_TIMELY (5s, node3.stats.count (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::in) != 0);
+}
+
 TEST (network, send_invalid_publish)
 {
 	nano::test::system system (2);
@@ -8,6 +8,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 TEST (network_filter, apply)
 {
 	nano::network_filter filter (4);
@@ -165,3 +168,43 @@ TEST (network_filter, expire)
 	ASSERT_FALSE (filter.check (2)); // Entry with epoch 1 should be expired
 	ASSERT_FALSE (filter.apply (2)); // Entry with epoch 1 should be replaced
 }
+
+TEST (network_filter, striped)
+{
+	// Large enough to be split into all stripes, with a partially filled last stripe
+	nano::network_filter filter (nano::network_filter::max_stripes * 4 + 3);
+	for (nano::uint128_t i = 1; i <= 1000; ++i)
+	{
+		filter.apply (i);
+	}
+	filter.clear ();
+	for (nano::uint128_t i = 1; i <= 1000; ++i)
+	{
+		ASSERT_FALSE (filter.check (i));
+	}
+}
+
+TEST (network_filter, concurrent)
+{
+	nano::network_filter filter (1024 * 1024);
+	std::atomic<int> duplicates{ 0 };
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+	{
+		threads.emplace_back ([&filter, &duplicates] () {
+			// Every thread applies the same digests, each digest must be reported as new exactly once
+			for (nano::uint128_t i = 1; i <= 10000; ++i)
+			{
+				if (filter.apply (i))
+				{
+					++duplicates;
+				}
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	ASSERT_EQ (3 * 10000, duplicates);
+}
@@ -2419,6 +2419,94 @@ TEST (node, block_processor_reject_state)
 	ASSERT_TIMELY (5s, node.block_or_pruned_exists (send2->hash ()));
 }
 
+/*
+ * Known blocks and invalidly signed blocks are filtered out before entering the ledger, results must be the same as if processed by the ledger
+ */
+TEST (node, block_processor_prevalidation)
+{
+	nano::test::system system (1);
+	auto & node (*system.nodes[0]);
+	nano::state_block_builder builder;
+	auto send1 = builder.make_block ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - nano::Knano_ratio)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*node.work_generate_blocking (nano::dev::genesis->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, node.block_processor.add_blocking (send1, nano::block_source::local));
+	ASSERT_EQ (nano::block_status::old, node.block_processor.add_blocking (send1, nano::block_source::local));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::block_processor, nano::stat::detail::prevalidation_old));
+	auto send2 = builder.make_block ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2 * nano::Knano_ratio)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*node.work_generate_blocking (send1->hash ()))
+				 .build ();
+	send2->signature.bytes[0] ^= 1;
+	ASSERT_EQ (nano::block_status::bad_signature, node.block_processor.add_blocking (send2, nano::block_source::local));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::block_processor, nano::stat::detail::prevalidation_rejected));
+	ASSERT_FALSE (node.block_or_pruned_exists (send2->hash ()));
+	auto send3 = builder.make_block ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 3 * nano::Knano_ratio)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (0)
+				 .build ();
+	while (!nano::dev::network_params.work.validate_entry (*send3))
+	{
+		send3->block_work_set (send3->block_work () + 1);
+	}
+	ASSERT_EQ (nano::block_status::insufficient_work, node.block_processor.add_blocking (send3, nano::block_source::local));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::block_processor, nano::stat::detail::insufficient_work));
+	ASSERT_FALSE (node.block_or_pruned_exists (send3->hash ()));
+	ASSERT_EQ (0, node.block_processor.size ());
+}
+
+/*
+ * Batches are pre-validated by several threads but must be applied to the ledger in the order they were taken from the queue
+ */
+TEST (node, block_processor_prevalidation_order)
+{
+	nano::test::system system;
+	auto config = system.default_config ();
+	config.block_processor.prevalidation_threads = 4;
+	config.block_processor.batch_size = 1;
+	auto & node = *system.add_node (config);
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	auto latest = nano::dev::genesis->hash ();
+	for (auto i = 1; i <= 32; ++i)
+	{
+		auto send = builder.state ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (latest)
+					.representative (nano::dev::genesis_key.pub)
+					.balance (nano::dev::constants.genesis_amount - i)
+					.link (nano::dev::genesis_key.pub)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*system.work.generate (latest))
+					.build ();
+		latest = send->hash ();
+		blocks.push_back (send);
+	}
+	for (auto const & block : blocks)
+	{
+		ASSERT_TRUE (node.block_processor.add (block, nano::block_source::local));
+	}
+	ASSERT_TIMELY (5s, nano::test::exists (node, blocks));
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::ledger, nano::stat::detail::gap_previous));
+	ASSERT_EQ (blocks.size (), node.stats.count (nano::stat::type::block_processor_result, nano::stat::detail::progress));
+}
+
 TEST (node, confirm_back)
 {
 	nano::test::system system (1);
@@ -0,0 +1,166 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/logging.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/node/signature_checker.hpp>
+#include <nano/secure/common.hpp>
+#include <nano/secure/vote.hpp>
+#include <nano/test_common/system.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<std::shared_ptr<nano::vote>> make_votes (size_t count)
+{
+	std::vector<std::shared_ptr<nano::vote>> votes;
+	for (size_t i = 0; i < count; ++i)
+	{
+		nano::keypair key;
+		votes.push_back (std::make_shared<nano::vote> (key.pub, key.prv, nano::vote::timestamp_min * (i + 1), 0, std::vector<nano::block_hash>{ nano::dev::genesis->hash () }));
+	}
+	return votes;
+}
+
+// Adds twice the group order to S, single verification rejects the result while the batch equation alone would accept it
+void malleate (nano::signature & signature)
+{
+	uint8_t const order_2[32] = { 0xda, 0xa7, 0xeb, 0xb9, 0x34, 0xc6, 0x24, 0xb0, 0xac, 0x39, 0xef, 0x45, 0xbd, 0xf3, 0xbd, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20 };
+	unsigned carry = 0;
+	for (size_t i = 0; i < 32; ++i)
+	{
+		carry += signature.bytes[32 + i] + order_2[i];
+		signature.bytes[32 + i] = static_cast<uint8_t> (carry);
+		carry >>= 8;
+	}
+}
+}
+
+TEST (signature_checker, empty)
+{
+	nano::test::system system;
+	nano::signature_checker checker{ 2, 0, system.stats };
+	ASSERT_TRUE (checker.verify (std::vector<std::shared_ptr<nano::vote>>{}).empty ());
+	checker.stop ();
+}
+
+TEST (signature_checker, votes)
+{
+	nano::test::system system;
+	// Small batch size to ensure work is split between multiple threads
+	nano::signature_checker checker{ 4, 64, system.stats };
+
+	auto votes = make_votes (1000);
+	for (size_t i = 0; i < votes.size (); i += 37)
+	{
+		votes[i]->signature.bytes[1] ^= 1;
+	}
+
+	auto invalid = checker.verify (votes);
+	ASSERT_EQ (invalid.size (), votes.size ());
+	for (size_t i = 0; i < votes.size (); ++i)
+	{
+		ASSERT_EQ (invalid[i], i % 37 == 0);
+	}
+	ASSERT_EQ (system.stats.count (nano::stat::type::signature_checker, nano::stat::detail::vote), votes.size ());
+	ASSERT_EQ (system.stats.count (nano::stat::type::signature_checker, nano::stat::detail::invalid), (votes.size () + 36) / 37);
+	checker.stop ();
+}
+
+TEST (signature_checker, blocks)
+{
+	nano::test::system system;
+	nano::signature_checker checker{ 1, 0, system.stats };
+
+	nano::keypair key;
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	std::vector<nano::public_key> signers;
+	for (int i = 0; i < 300; ++i)
+	{
+		auto block = builder
+					 .state ()
+					 .account (key.pub)
+					 .previous (0)
+					 .representative (key.pub)
+					 .balance (i)
+					 .link (0)
+					 .sign (key.prv, key.pub)
+					 .work (0)
+					 .build ();
+		blocks.push_back (block);
+		signers.push_back (key.pub);
+	}
+	// Signed by a different key than expected
+	signers[7] = nano::dev::genesis_key.pub;
+
+	auto invalid = checker.verify (blocks, signers);
+	ASSERT_EQ (invalid.size (), blocks.size ());
+	for (size_t i = 0; i < blocks.size (); ++i)
+	{
+		ASSERT_EQ (invalid[i], i == 7);
+	}
+	checker.stop ();
+}
+
+/*
+ * Results must match `validate_message` for signatures that batch verification alone would accept
+ */
+TEST (signature_checker, non_canonical)
+{
+	nano::test::system system;
+	nano::signature_checker checker{ 2, 0, system.stats };
+
+	auto votes = make_votes (64);
+	malleate (votes[5]->signature);
+	ASSERT_TRUE (votes[5]->validate ());
+	auto invalid_votes = checker.verify (votes);
+	for (size_t i = 0; i < votes.size (); ++i)
+	{
+		ASSERT_EQ (invalid_votes[i], votes[i]->validate ());
+	}
+
+	nano::keypair key;
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	std::vector<nano::public_key> signers;
+	for (int i = 0; i < 64; ++i)
+	{
+		auto block = builder
+					 .state ()
+					 .account (key.pub)
+					 .previous (0)
+					 .representative (key.pub)
+					 .balance (i)
+					 .link (0)
+					 .sign (key.prv, key.pub)
+					 .work (0)
+					 .build ();
+		blocks.push_back (block);
+		signers.push_back (key.pub);
+	}
+	auto signature = blocks[9]->block_signature ();
+	malleate (signature);
+	blocks[9]->signature_set (signature);
+	auto invalid_blocks = checker.verify (blocks, signers);
+	for (size_t i = 0; i < blocks.size (); ++i)
+	{
+		ASSERT_EQ (invalid_blocks[i], i == 9);
+	}
+	checker.stop ();
+}
+
+/*
+ * Tasks must not be dispatched to a stopped pool, verification should still complete on the calling thread
+ */
+TEST (signature_checker, stopped)
+{
+	nano::test::system system;
+	nano::signature_checker checker{ 2, 64, system.stats };
+	checker.stop ();
+
+	auto votes = make_votes (500);
+	auto invalid = checker.verify (votes);
+	ASSERT_EQ (invalid.size (), votes.size ());
+	ASSERT_TRUE (std::none_of (invalid.begin (), invalid.end (), [] (bool invalid) { return invalid; }));
+}
@@ -310,12 +310,14 @@ TEST (toml_config, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.unchecked_cutoff_time, defaults.node.unchecked_cutoff_time);
 	ASSERT_EQ (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_EQ (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
+	ASSERT_EQ (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
 	ASSERT_EQ (conf.node.vote_minimum, defaults.node.vote_minimum);
 	ASSERT_EQ (conf.node.work_peers, defaults.node.work_peers);
 	ASSERT_EQ (conf.node.work_threads, defaults.node.work_threads);
 	ASSERT_EQ (conf.node.max_queued_requests, defaults.node.max_queued_requests);
 	ASSERT_EQ (conf.node.request_aggregator_threads, defaults.node.request_aggregator_threads);
 	ASSERT_EQ (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_EQ (conf.node.max_unchecked_disk_blocks, defaults.node.max_unchecked_disk_blocks);
 	ASSERT_EQ (conf.node.max_backlog, defaults.node.max_backlog);
 	ASSERT_EQ (conf.node.enable_upnp, defaults.node.enable_upnp);
 
@@ -331,6 +333,7 @@ TEST (toml_config, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.websocket_config.enabled, defaults.node.websocket_config.enabled);
 	ASSERT_EQ (conf.node.websocket_config.address, defaults.node.websocket_config.address);
 	ASSERT_EQ (conf.node.websocket_config.port, defaults.node.websocket_config.port);
+	ASSERT_EQ (conf.node.websocket_config.max_queued_messages, defaults.node.websocket_config.max_queued_messages);
 
 	ASSERT_EQ (conf.node.callback_address, defaults.node.callback_address);
 	ASSERT_EQ (conf.node.callback_port, defaults.node.callback_port);
@@ -364,11 +367,19 @@ TEST (toml_config, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_EQ (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_EQ (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_EQ (conf.node.lmdb_config.read_transaction_pool, defaults.node.lmdb_config.read_transaction_pool);
+	ASSERT_EQ (conf.node.lmdb_config.read_transaction_max_idle, defaults.node.lmdb_config.read_transaction_max_idle);
+	ASSERT_EQ (conf.node.lmdb_config.read_transaction_max_staleness, defaults.node.lmdb_config.read_transaction_max_staleness);
 
 	ASSERT_EQ (conf.node.rocksdb_config.enable, defaults.node.rocksdb_config.enable);
 	ASSERT_EQ (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_EQ (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_EQ (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_EQ (conf.node.rocksdb_config.shared_read_cache, defaults.node.rocksdb_config.shared_read_cache);
+	ASSERT_EQ (conf.node.rocksdb_config.blocks.block_size, defaults.node.rocksdb_config.blocks.block_size);
+	ASSERT_EQ (conf.node.rocksdb_config.blocks.partitioned_filters, defaults.node.rocksdb_config.blocks.partitioned_filters);
+	ASSERT_EQ (conf.node.rocksdb_config.blocks.pin_l0_filters, defaults.node.rocksdb_config.blocks.pin_l0_filters);
+	ASSERT_EQ (conf.node.rocksdb_config.pending.block_size, defaults.node.rocksdb_config.pending.block_size);
 
 	ASSERT_EQ (conf.node.optimistic_scheduler.enable, defaults.node.optimistic_scheduler.enable);
 	ASSERT_EQ (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -383,11 +394,14 @@ TEST (toml_config, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_EQ (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
 
+	ASSERT_EQ (conf.node.block_cache.max_memory, defaults.node.block_cache.max_memory);
+
 	ASSERT_EQ (conf.node.block_processor.max_peer_queue, defaults.node.block_processor.max_peer_queue);
 	ASSERT_EQ (conf.node.block_processor.max_system_queue, defaults.node.block_processor.max_system_queue);
 	ASSERT_EQ (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_EQ (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_EQ (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_EQ (conf.node.block_processor.prevalidation_threads, defaults.node.block_processor.prevalidation_threads);
 
 	ASSERT_EQ (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_EQ (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
@@ -470,6 +484,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	unchecked_cutoff_time = 999
 	use_memory_pools = false
 	vote_generator_delay = 999
+	vote_generator_threads = 999
 	vote_minimum = "999"
 	work_peers = ["dev.org:999"]
 	work_threads = 999
@@ -477,6 +492,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	max_queued_requests = 999
 	request_aggregator_threads = 999
 	max_unchecked_blocks = 999
+	max_unchecked_disk_blocks = 999
 	max_backlog = 999
 	frontiers_confirmation = "always"
 	enable_upnp = false
@@ -498,6 +514,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	priority_live = 999
 	priority_bootstrap = 999
 	priority_local = 999
+	prevalidation_threads = 999
 
 	[node.active_elections]
 	size = 999
@@ -578,12 +595,16 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	[node.websocket]
 	address = "0:0:0:0:0:ffff:7f01:101"
 	enable = true
+	max_queued_messages = 999
 	port = 999
 
 	[node.lmdb]
 	sync = "nosync_safe"
 	max_databases = 999
 	map_size = 999
+	read_transaction_pool = 9
+	read_transaction_max_idle = 999
+	read_transaction_max_staleness = 999
 
 	[node.optimistic_scheduler]
 	enable = false
@@ -602,6 +623,15 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	io_threads = 99
 	read_cache = 99
 	write_cache = 99
+	shared_read_cache = 99
+
+	[node.rocksdb.blocks]
+	block_size = 16
+	partitioned_filters = true
+	pin_l0_filters = true
+
+	[node.rocksdb.pending]
+	block_size = 8
 
 	[node.experimental]
 	secondary_work_peers = ["dev.org:998"]
@@ -612,6 +642,9 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	max_size = 999
 	max_voters = 999
 
+	[node.block_cache]
+	max_memory = 999
+
 	[node.vote_processor]
 	max_pr_queue = 999
 	max_non_pr_queue = 999
@@ -710,6 +743,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.io_threads, defaults.node.io_threads);
 	ASSERT_NE (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_NE (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_NE (conf.node.max_unchecked_disk_blocks, defaults.node.max_unchecked_disk_blocks);
 	ASSERT_NE (conf.node.max_backlog, defaults.node.max_backlog);
 	ASSERT_NE (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_NE (conf.node.background_threads, defaults.node.background_threads);
@@ -730,6 +764,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.unchecked_cutoff_time, defaults.node.unchecked_cutoff_time);
 	ASSERT_NE (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_NE (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
+	ASSERT_NE (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
 	ASSERT_NE (conf.node.vote_minimum, defaults.node.vote_minimum);
 	ASSERT_NE (conf.node.work_peers, defaults.node.work_peers);
 	ASSERT_NE (conf.node.work_threads, defaults.node.work_threads);
@@ -749,6 +784,7 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.websocket_config.enabled, defaults.node.websocket_config.enabled);
 	ASSERT_NE (conf.node.websocket_config.address, defaults.node.websocket_config.address);
 	ASSERT_NE (conf.node.websocket_config.port, defaults.node.websocket_config.port);
+	ASSERT_NE (conf.node.websocket_config.max_queued_messages, defaults.node.websocket_config.max_queued_messages);
 
 	ASSERT_NE (conf.node.callback_address, defaults.node.callback_address);
 	ASSERT_NE (conf.node.callback_port, defaults.node.callback_port);
@@ -782,12 +818,21 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_NE (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_NE (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_NE (conf.node.lmdb_config.read_transaction_pool, defaults.node.lmdb_config.read_transaction_pool);
+	ASSERT_NE (conf.node.lmdb_config.read_transaction_max_idle, defaults.node.lmdb_config.read_transaction_max_idle);
+	ASSERT_NE (conf.node.lmdb_config.read_transaction_max_staleness, defaults.node.lmdb_config.read_transaction_max_staleness);
 
 	ASSERT_TRUE (conf.node.rocksdb_config.enable);
 	ASSERT_EQ (nano::rocksdb_config::using_rocksdb_in_tests (), defaults.node.rocksdb_config.enable);
 	ASSERT_NE (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_NE (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_NE (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_NE (conf.node.rocksdb_config.shared_read_cache, defaults.node.rocksdb_config.shared_read_cache);
+	ASSERT_NE (conf.node.rocksdb_config.blocks.block_size, defaults.node.rocksdb_config.blocks.block_size);
+	ASSERT_NE (conf.node.rocksdb_config.blocks.partitioned_filters, defaults.node.rocksdb_config.blocks.partitioned_filters);
+	ASSERT_NE (conf.node.rocksdb_config.blocks.pin_l0_filters, defaults.node.rocksdb_config.blocks.pin_l0_filters);
+	ASSERT_NE (conf.node.rocksdb_config.pending.block_size, defaults.node.rocksdb_config.pending.block_size);
+	ASSERT_EQ (conf.node.rocksdb_config.accounts.block_size, defaults.node.rocksdb_config.accounts.block_size);
 
 	ASSERT_NE (conf.node.optimistic_scheduler.enable, defaults.node.optimistic_scheduler.enable);
 	ASSERT_NE (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -802,11 +847,14 @@ TEST (toml_config, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_NE (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
 
+	ASSERT_NE (conf.node.block_cache.max_memory, defaults.node.block_cache.max_memory);
+
 	ASSERT_NE (conf.node.block_processor.max_peer_queue, defaults.node.block_processor.max_peer_queue);
 	ASSERT_NE (conf.node.block_processor.max_system_queue, defaults.node.block_processor.max_system_queue);
 	ASSERT_NE (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_NE (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_NE (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_NE (conf.node.block_processor.prevalidation_threads, defaults.node.block_processor.prevalidation_threads);
 
 	ASSERT_NE (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_NE (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
@@ -9,7 +9,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -280,3 +282,197 @@ TEST (unchecked, multiple_get)
 	auto unchecked5 = unchecked.get (block2->hash ());
 	ASSERT_EQ (unchecked5.size (), 0);
 }
+
+// Entries past the memory limit are moved to disk, where they can still be found and satisfied
+TEST (unchecked, spill)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ 1, 16, nano::unique_path () / "unchecked.ldb", system.stats, system.logger, false };
+	unchecked.start ();
+	nano::block_builder builder;
+	auto block1 = builder
+				  .send ()
+				  .previous (4)
+				  .destination (1)
+				  .balance (2)
+				  .sign (nano::keypair ().prv, 4)
+				  .work (5)
+				  .build ();
+	auto block2 = builder
+				  .send ()
+				  .previous (3)
+				  .destination (1)
+				  .balance (2)
+				  .sign (nano::keypair ().prv, 4)
+				  .work (5)
+				  .build ();
+	auto block3 = builder
+				  .send ()
+				  .previous (5)
+				  .destination (1)
+				  .balance (2)
+				  .sign (nano::keypair ().prv, 4)
+				  .work (5)
+				  .build ();
+	unchecked.put (block1->previous (), nano::unchecked_info (block1));
+	unchecked.put (block2->previous (), nano::unchecked_info (block2));
+	unchecked.put (block3->previous (), nano::unchecked_info (block3));
+	// The two oldest entries were moved to disk as a batch
+	ASSERT_EQ (1, unchecked.entries_size ());
+	ASSERT_EQ (2, unchecked.spilled_size ());
+	ASSERT_EQ (3, unchecked.count ());
+	ASSERT_EQ (2, system.stats.count (nano::stat::type::unchecked, nano::stat::detail::spill));
+	ASSERT_TRUE (unchecked.exists (nano::unchecked_key{ block1->previous (), block1->hash () }));
+	auto blocks = unchecked.get (block1->previous ());
+	ASSERT_EQ (1, blocks.size ());
+	ASSERT_EQ (*block1, *blocks[0].block);
+
+	std::atomic<size_t> satisfied{ 0 };
+	unchecked.satisfied.add ([&satisfied, &block1] (nano::unchecked_info const & info) {
+		if (info.block->hash () == block1->hash ())
+		{
+			++satisfied;
+		}
+	});
+	unchecked.trigger (block1->previous ());
+	ASSERT_TIMELY_EQ (5s, 1, satisfied);
+	ASSERT_TIMELY_EQ (5s, 1, unchecked.spilled_size ());
+	ASSERT_TRUE (unchecked.get (block1->previous ()).empty ());
+	ASSERT_EQ (2, unchecked.count ());
+	unchecked.stop ();
+}
+
+// Putting an entry that was already moved to disk doesn't add a second copy in memory
+TEST (unchecked, spill_double_put)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ 1, 16, nano::unique_path () / "unchecked.ldb", system.stats, system.logger, false };
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i = 0; i < 3; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (4 + i)
+						  .destination (1)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build ());
+	}
+	for (auto const & block : blocks)
+	{
+		unchecked.put (block->previous (), nano::unchecked_info (block));
+	}
+	ASSERT_EQ (2, unchecked.spilled_size ());
+	unchecked.put (blocks[0]->previous (), nano::unchecked_info (blocks[0]));
+	ASSERT_EQ (1, unchecked.entries_size ());
+	ASSERT_EQ (3, unchecked.count ());
+	ASSERT_EQ (1, unchecked.get (blocks[0]->previous ()).size ());
+}
+
+// Producers putting entries, some of them twice, while others look them up and batches are being moved to disk
+TEST (unchecked, spill_concurrent)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ 64, 100000, nano::unique_path () / "unchecked.ldb", system.stats, system.logger, false };
+	unchecked.start ();
+	nano::block_builder builder;
+	size_t const producers = 4;
+	size_t const per_producer = 500;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (size_t i = 0; i < producers * per_producer; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (1 + i)
+						  .destination (1)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build ());
+	}
+	std::atomic<bool> done{ false };
+	std::thread reader ([&unchecked, &blocks, &done] () {
+		while (!done)
+		{
+			for (auto const & block : blocks)
+			{
+				EXPECT_LE (unchecked.get (block->previous ()).size (), 1);
+			}
+		}
+	});
+	std::vector<std::thread> threads;
+	for (size_t producer = 0; producer < producers; ++producer)
+	{
+		threads.emplace_back ([&unchecked, &blocks, producer, per_producer] () {
+			for (auto i = producer * per_producer, n = i + per_producer; i < n; ++i)
+			{
+				unchecked.put (blocks[i]->previous (), nano::unchecked_info (blocks[i]));
+				// Put an earlier entry again, it may be in memory, in a batch being written or on disk by now
+				auto back = (i % 8) * 16;
+				if (i >= producer * per_producer + back)
+				{
+					unchecked.put (blocks[i - back]->previous (), nano::unchecked_info (blocks[i - back]));
+				}
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	done = true;
+	reader.join ();
+
+	ASSERT_LT (0, unchecked.spilled_size ());
+	ASSERT_EQ (blocks.size (), unchecked.count ());
+	for (auto const & block : blocks)
+	{
+		ASSERT_EQ (1, unchecked.get (block->previous ()).size ());
+	}
+
+	std::atomic<size_t> satisfied{ 0 };
+	unchecked.satisfied.add ([&satisfied] (nano::unchecked_info const & info) {
+		++satisfied;
+	});
+	for (auto const & block : blocks)
+	{
+		unchecked.trigger (block->previous ());
+	}
+	ASSERT_TIMELY_EQ (10s, blocks.size (), satisfied);
+	ASSERT_TIMELY_EQ (5s, 0, unchecked.count ());
+	unchecked.stop ();
+}
+
+// Spilled entries are not kept across restarts, otherwise entries that are never satisfied would fill the disk budget for good
+TEST (unchecked, spill_restart)
+{
+	nano::test::system system{};
+	auto path = nano::unique_path () / "unchecked.ldb";
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i = 0; i < 3; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (4 + i)
+						  .destination (1)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build ());
+	}
+	{
+		nano::unchecked_map unchecked{ 1, 16, path, system.stats, system.logger, false };
+		for (auto const & block : blocks)
+		{
+			unchecked.put (block->previous (), nano::unchecked_info (block));
+		}
+		ASSERT_EQ (2, unchecked.spilled_size ());
+	}
+	nano::unchecked_map unchecked{ 1, 16, path, system.stats, system.logger, false };
+	ASSERT_EQ (0, unchecked.spilled_size ());
+	ASSERT_EQ (0, unchecked.count ());
+	ASSERT_TRUE (unchecked.get (blocks[0]->previous ()).empty ());
+}
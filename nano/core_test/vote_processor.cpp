@@ -58,6 +58,37 @@ TEST (vote_processor, codes)
 	ASSERT_EQ (nano::vote_code::indeterminate, node.vote_processor.vote_blocking (vote, channel));
 }
 
+TEST (vote_router, batch)
+{
+	nano::test::system system;
+	auto node_config = system.default_config ();
+	// Disable all election schedulers
+	node_config.backlog_scan.enable = false;
+	node_config.hinted_scheduler.enable = false;
+	node_config.optimistic_scheduler.enable = false;
+	auto & node = *system.add_node (node_config);
+
+	auto blocks = nano::test::setup_chain (system, node, 3, nano::dev::genesis_key, false);
+	ASSERT_TRUE (nano::test::start_elections (system, node, { blocks[0], blocks[1] }));
+
+	auto vote1 = nano::test::make_vote (nano::dev::genesis_key, { blocks[0] }, nano::vote::timestamp_min * 1, 0);
+	auto vote2 = nano::test::make_vote (nano::dev::genesis_key, { blocks[2] }, nano::vote::timestamp_min * 1, 0);
+	auto vote3 = nano::test::make_vote (nano::dev::genesis_key, { blocks[0], blocks[1] }, nano::vote::timestamp_min * 1, 0);
+
+	// Votes in a batch are applied in order, so a repeated vote in the same batch is a replay
+	auto results = node.vote_router.vote ({ { vote1, nano::vote_source::live }, { vote2, nano::vote_source::live }, { vote1, nano::vote_source::live }, { vote3, nano::vote_source::live } });
+	ASSERT_EQ (4, results.size ());
+	ASSERT_EQ (nano::vote_code::vote, results[0].at (blocks[0]->hash ()));
+	ASSERT_EQ (nano::vote_code::indeterminate, results[1].at (blocks[2]->hash ()));
+	ASSERT_EQ (nano::vote_code::replay, results[2].at (blocks[0]->hash ()));
+	ASSERT_EQ (2, results[3].size ());
+	ASSERT_EQ (nano::vote_code::replay, results[3].at (blocks[0]->hash ()));
+	ASSERT_EQ (nano::vote_code::vote, results[3].at (blocks[1]->hash ()));
+
+	// Empty batch
+	ASSERT_TRUE (node.vote_router.vote (nano::vote_router::batch_t{}).empty ());
+}
+
 TEST (vote_processor, invalid_signature)
 {
 	nano::test::system system{ 1 };
@@ -107,7 +107,11 @@ TEST (vote_generator, multiple_representatives)
 			return vote_a->account == account;
 		}));
 		ASSERT_NE (votes.end (), existing);
+		ASSERT_FALSE ((*existing)->validate ());
 	}
+	// Votes for multiple representatives are signed by the signer threads
+	ASSERT_LT (0, node.stats.count (nano::stat::type::vote_generator, nano::stat::detail::generator_signed_parallel));
+	ASSERT_FALSE (node.stats.samples (nano::stat::sample::vote_generator_latency).empty ());
 }
 
 TEST (vote_spacing, basic)
@@ -1,4 +1,5 @@
 #include <nano/core_test/fakes/websocket_client.hpp>
+#include <nano/ipc_flatbuffers_lib/generated/flatbuffers/nanoapi_generated.h>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/jsonconfig.hpp>
 #include <nano/lib/work_version.hpp>
@@ -232,6 +233,72 @@ TEST (websocket, stopped_election)
 	ASSERT_EQ (event.get<std::string> ("topic"), "stopped_election");
 }
 
+// Tests subscribing with the flatbuffers encoding, messages are sent as binary envelopes
+TEST (websocket, started_election_flatbuffers)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = system.get_available_port ();
+	auto node1 = system.add_node (config);
+
+	std::atomic<bool> ack_ready{ false };
+	auto task = ([&ack_ready, config, &node1] () {
+		fake_websocket_client client (node1->websocket.server->listening_port ());
+		client.send_message (R"json({"action": "subscribe", "topic": "started_election", "encoding": "flatbuffers", "ack": "true"})json");
+		client.await_ack ();
+		ack_ready = true;
+		EXPECT_EQ (1, node1->websocket.server->subscriber_count (nano::websocket::topic::started_election));
+		return client.get_response ();
+	});
+	auto future = std::async (std::launch::async, task);
+
+	ASSERT_TIMELY (5s, ack_ready);
+
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto send1 = builder
+				 .send ()
+				 .previous (nano::dev::genesis->hash ())
+				 .destination (key1.pub)
+				 .balance (0)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	nano::publish publish1{ nano::dev::network_params.network, send1 };
+	auto channel1 = std::make_shared<nano::transport::fake::channel> (*node1);
+	node1->inbound (publish1, channel1);
+	ASSERT_TIMELY (1s, node1->active.election (send1->qualified_root ()));
+	ASSERT_TIMELY_EQ (5s, future.wait_for (0s), std::future_status::ready);
+
+	auto response = future.get ();
+	ASSERT_TRUE (response);
+	auto data (reinterpret_cast<uint8_t const *> (response->data ()));
+	flatbuffers::Verifier verifier (data, response->size ());
+	ASSERT_TRUE (nanoapi::VerifyEnvelopeBuffer (verifier));
+	auto envelope (nanoapi::GetEnvelope (data));
+	ASSERT_EQ (nanoapi::Message_EventElectionStarted, envelope->message_type ());
+	ASSERT_EQ (send1->hash ().to_string (), envelope->message_as_EventElectionStarted ()->hash ()->str ());
+}
+
+// Topics without a binary encoding reject flatbuffers subscriptions
+TEST (websocket, flatbuffers_unsupported_topic)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = system.get_available_port ();
+	auto node1 = system.add_node (config);
+
+	fake_websocket_client client (node1->websocket.server->listening_port ());
+	client.send_message (R"json({"action": "subscribe", "topic": "work", "encoding": "flatbuffers", "ack": "true"})json");
+	client.send_message (R"json({"action": "subscribe", "topic": "vote", "encoding": "xml", "ack": "true"})json");
+	client.send_message (R"json({"action": "subscribe", "topic": "vote", "encoding": "flatbuffers", "ack": "true"})json");
+	client.await_ack ();
+	ASSERT_EQ (0, node1->websocket.server->subscriber_count (nano::websocket::topic::work));
+	ASSERT_EQ (1, node1->websocket.server->subscriber_count (nano::websocket::topic::vote));
+}
+
 // Tests the filtering options of block confirmations
 TEST (websocket, confirmation_options)
 {
@@ -607,6 +674,112 @@ TEST (websocket, confirmation_options_update)
 	ASSERT_TIMELY_EQ (5s, future.wait_for (0s), std::future_status::ready);
 }
 
+// Sessions filtering on different accounts only receive the confirmations involving their accounts
+TEST (websocket, confirmation_options_accounts_index)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = system.get_available_port ();
+	auto node1 (system.add_node (config));
+
+	nano::keypair key;
+	nano::keypair other;
+	std::atomic<int> subscribed{ 0 };
+	auto subscribe = [&subscribed, &node1] (std::string const & message_a, bool expect_response_a) {
+		return std::async (std::launch::async, [&subscribed, &node1, message_a, expect_response_a] () {
+			fake_websocket_client client (node1->websocket.server->listening_port ());
+			client.send_message (message_a);
+			client.await_ack ();
+			++subscribed;
+			if (expect_response_a)
+			{
+				EXPECT_TRUE (client.get_response ());
+			}
+			else
+			{
+				EXPECT_FALSE (client.get_response (1s));
+			}
+		});
+	};
+	// Filtering on the destination, on an unrelated account and without any filter
+	auto destination_future = subscribe (boost::str (boost::format (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"confirmation_type": "active_quorum", "accounts": ["%1%"]}})json") % key.pub.to_account ()), true);
+	auto other_future = subscribe (boost::str (boost::format (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"confirmation_type": "active_quorum", "accounts": ["%1%"]}})json") % other.pub.to_account ()), false);
+	auto unfiltered_future = subscribe (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"confirmation_type": "active_quorum"}})json", true);
+
+	ASSERT_TIMELY_EQ (5s, subscribed, 3);
+	ASSERT_EQ (3, node1->websocket.server->subscriber_count (nano::websocket::topic::confirmation));
+
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	nano::state_block_builder builder;
+	auto previous (node1->latest (nano::dev::genesis_key.pub));
+	auto send = builder
+				.account (nano::dev::genesis_key.pub)
+				.previous (previous)
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - nano::Knano_ratio)
+				.link (key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*system.work.generate (previous))
+				.build ();
+	node1->process_active (send);
+
+	ASSERT_TIMELY_EQ (5s, destination_future.wait_for (0s), std::future_status::ready);
+	ASSERT_TIMELY_EQ (5s, other_future.wait_for (0s), std::future_status::ready);
+	ASSERT_TIMELY_EQ (5s, unfiltered_future.wait_for (0s), std::future_status::ready);
+
+	// The confirmation was written to the two interested sessions only
+	ASSERT_TIMELY_EQ (5s, 2, node1->stats.count (nano::stat::type::websocket_send, nano::stat::detail::confirmation));
+	ASSERT_LT (0, node1->stats.count (nano::stat::type::websocket_send_bytes, nano::stat::detail::confirmation));
+	ASSERT_EQ (0, node1->stats.count (nano::stat::type::websocket_drop));
+}
+
+// A client that stops reading has the oldest messages waiting in its full queue dropped
+TEST (websocket, slow_session_drops_oldest)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = system.get_available_port ();
+	config.websocket_config.max_queued_messages = 2;
+	auto node1 (system.add_node (config));
+
+	fake_websocket_client client (node1->websocket.server->listening_port ());
+	client.send_message (R"json({"action": "subscribe", "topic": "work", "ack": true})json");
+	client.await_ack ();
+	ASSERT_EQ (1, node1->websocket.server->subscriber_count (nano::websocket::topic::work));
+
+	// Messages larger than the socket buffers, so the first write stalls until the client reads
+	std::string const padding (12 * 1024 * 1024, 'x');
+	for (int i = 0; i < 4; ++i)
+	{
+		boost::property_tree::ptree contents;
+		contents.put ("index", i);
+		contents.put ("padding", padding);
+		node1->websocket.server->broadcast (nano::websocket::message (nano::websocket::topic::work, contents));
+	}
+
+	// The first message is being written, the second and third were dropped when the next one was queued
+	ASSERT_TIMELY_EQ (5s, 2, node1->stats.count (nano::stat::type::websocket_drop, nano::stat::detail::work));
+	ASSERT_EQ (2, node1->stats.count (nano::stat::type::websocket_drop));
+
+	auto index = [] (boost::optional<std::string> const & response) {
+		std::stringstream stream;
+		stream << *response;
+		boost::property_tree::ptree event;
+		boost::property_tree::read_json (stream, event);
+		return event.get<int> ("index");
+	};
+	auto response1 = client.get_response (10s);
+	ASSERT_TRUE (response1);
+	ASSERT_EQ (0, index (response1));
+	auto response2 = client.get_response (10s);
+	ASSERT_TRUE (response2);
+	ASSERT_EQ (3, index (response2));
+	ASSERT_TIMELY_EQ (5s, 2, node1->stats.count (nano::stat::type::websocket_send, nano::stat::detail::work));
+	ASSERT_EQ (2, node1->stats.count (nano::stat::type::websocket_drop));
+}
+
 // Subscribes to votes, sends a block and awaits websocket notification of a vote arrival
 TEST (websocket, vote)
 {
@@ -3,6 +3,7 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/lib/work.hpp>
+#include <nano/lib/work_kernels.hpp>
 #include <nano/lib/work_version.hpp>
 #include <nano/node/openclconfig.hpp>
 #include <nano/node/openclwork.hpp>
@@ -11,6 +12,9 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/endian/conversion.hpp>
+
+#include <array>
 #include <future>
 
 // produce one proof of work for a block and check that its difficulty is higher than the base difficulty
@@ -55,6 +59,41 @@ TEST (work, validate)
 	ASSERT_GE (nano::dev::network_params.work.difficulty (*send_block), nano::dev::network_params.work.threshold_base (send_block->work_version ()));
 }
 
+// check that every vectorized work kernel supported by this CPU computes the same values as the reference blake2b implementation
+TEST (work, kernels)
+{
+	for (auto type : { nano::work_kernels::kernel_type::portable, nano::work_kernels::kernel_type::avx2, nano::work_kernels::kernel_type::avx512 })
+	{
+		if (!nano::work_kernels::supported (type))
+		{
+			continue;
+		}
+		auto kernel = nano::work_kernels::get (type);
+		for (auto i (0); i < 64; ++i)
+		{
+			nano::root root;
+			nano::random_pool::generate_block (root.bytes.data (), root.bytes.size ());
+			std::array<uint64_t, 4> words;
+			for (auto j (0u); j < words.size (); ++j)
+			{
+				words[j] = boost::endian::load_little_u64 (root.bytes.data () + j * sizeof (uint64_t));
+			}
+			std::array<uint64_t, nano::work_kernels::batch_size> nonces;
+			std::array<uint64_t, nano::work_kernels::batch_size> values;
+			nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (nonces.data ()), nonces.size () * sizeof (uint64_t));
+			for (auto & nonce : nonces)
+			{
+				nonce = boost::endian::native_to_little (nonce);
+			}
+			kernel (words.data (), nonces.data (), values.data ());
+			for (auto j (0u); j < nonces.size (); ++j)
+			{
+				ASSERT_EQ (nano::dev::network_params.work.value (root, boost::endian::little_to_native (nonces[j])), boost::endian::little_to_native (values[j]));
+			}
+		}
+	}
+}
+
 // repeatedly start and cancel a work calculation and check that the callback is eventually called
 TEST (work, cancel)
 {
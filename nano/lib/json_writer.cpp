@@ -0,0 +1,221 @@
+#include <nano/lib/assert.hpp>
+#include <nano/lib/json_writer.hpp>
+
+#include <cstdio>
+
+nano::json_writer::json_writer (sink_t sink_a, std::size_t chunk_size_a) :
+	sink{ std::move (sink_a) },
+	chunk_size{ chunk_size_a }
+{
+	buffer.reserve (chunk_size);
+}
+
+void nano::json_writer::begin_object ()
+{
+	begin ('{', '}', std::nullopt);
+}
+
+void nano::json_writer::begin_object (std::string_view key_a)
+{
+	begin ('{', '}', key_a);
+}
+
+void nano::json_writer::end_object ()
+{
+	debug_assert (!containers.empty () && containers.back ().close == '}');
+	end ();
+}
+
+void nano::json_writer::begin_array ()
+{
+	begin ('[', ']', std::nullopt);
+}
+
+void nano::json_writer::begin_array (std::string_view key_a)
+{
+	begin ('[', ']', key_a);
+}
+
+void nano::json_writer::end_array ()
+{
+	debug_assert (!containers.empty () && containers.back ().close == ']');
+	end ();
+}
+
+void nano::json_writer::end ()
+{
+	debug_assert (!containers.empty ());
+	auto const & back = containers.back ();
+	if (back.opened)
+	{
+		buffer.push_back (back.close);
+	}
+	else
+	{
+		// Written like an empty property tree child, which is an empty string rather than {} or []
+		auto const index = containers.size () - 1;
+		open_container (index - 1);
+		auto & parent = containers[index - 1];
+		if (!parent.first)
+		{
+			buffer.push_back (',');
+		}
+		parent.first = false;
+		if (back.key)
+		{
+			string (*back.key);
+			buffer.push_back (':');
+		}
+		buffer.append ("\"\"");
+	}
+	containers.pop_back ();
+	flush_if_full ();
+}
+
+void nano::json_writer::value (std::string_view value_a)
+{
+	separator ();
+	string (value_a);
+	flush_if_full ();
+}
+
+void nano::json_writer::value (std::string_view key_a, std::string_view value_a)
+{
+	key (key_a);
+	string (value_a);
+	flush_if_full ();
+}
+
+void nano::json_writer::flush ()
+{
+	if (!failed_m && !buffer.empty ())
+	{
+		flushed_bytes += buffer.size ();
+		failed_m = !sink (buffer);
+	}
+	buffer.clear ();
+}
+
+bool nano::json_writer::finish ()
+{
+	debug_assert (containers.empty () || failed_m);
+	flush ();
+	return !failed_m;
+}
+
+bool nano::json_writer::failed () const
+{
+	return failed_m;
+}
+
+std::size_t nano::json_writer::flushed () const
+{
+	return flushed_bytes;
+}
+
+void nano::json_writer::begin (char open_a, char close_a, std::optional<std::string_view> key_a)
+{
+	if (containers.empty ())
+	{
+		// The outermost container is always written, even when empty
+		debug_assert (!key_a);
+		containers.push_back ({ open_a, close_a, std::nullopt, true });
+		buffer.push_back (open_a);
+	}
+	else
+	{
+		// Nested containers are written once they get their first element
+		containers.push_back ({ open_a, close_a, key_a ? std::optional<std::string>{ *key_a } : std::nullopt, false });
+	}
+}
+
+void nano::json_writer::open_container (std::size_t index_a)
+{
+	auto & current = containers[index_a];
+	if (!current.opened)
+	{
+		debug_assert (index_a > 0);
+		open_container (index_a - 1);
+		auto & parent = containers[index_a - 1];
+		if (!parent.first)
+		{
+			buffer.push_back (',');
+		}
+		parent.first = false;
+		if (current.key)
+		{
+			string (*current.key);
+			buffer.push_back (':');
+		}
+		buffer.push_back (current.open);
+		current.opened = true;
+	}
+}
+
+void nano::json_writer::separator ()
+{
+	if (!containers.empty ())
+	{
+		open_container (containers.size () - 1);
+		auto & back = containers.back ();
+		if (!back.first)
+		{
+			buffer.push_back (',');
+		}
+		back.first = false;
+	}
+}
+
+void nano::json_writer::key (std::string_view key_a)
+{
+	separator ();
+	string (key_a);
+	buffer.push_back (':');
+}
+
+void nano::json_writer::string (std::string_view value_a)
+{
+	buffer.push_back ('"');
+	for (auto c : value_a)
+	{
+		switch (c)
+		{
+			case '"':
+				buffer.append ("\\\"");
+				break;
+			case '\\':
+				buffer.append ("\\\\");
+				break;
+			case '\n':
+				buffer.append ("\\n");
+				break;
+			case '\r':
+				buffer.append ("\\r");
+				break;
+			case '\t':
+				buffer.append ("\\t");
+				break;
+			default:
+				if (static_cast<unsigned char> (c) < 0x20)
+				{
+					char escaped[7];
+					std::snprintf (escaped, sizeof (escaped), "\\u%04x", static_cast<unsigned> (c));
+					buffer.append (escaped);
+				}
+				else
+				{
+					buffer.push_back (c);
+				}
+				break;
+		}
+	}
+	buffer.push_back ('"');
+}
+
+void nano::json_writer::flush_if_full ()
+{
+	if (buffer.size () >= chunk_size)
+	{
+		flush ();
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Forward only JSON writer that emits the document in chunks instead of building it in memory.
+ * All values are written as strings and empty nested objects and arrays as "", to match the output of `boost::property_tree::write_json`.
+ * Buffered output is handed to the sink whenever it exceeds the chunk size, once the sink returns false the writer stops producing output.
+ */
+class json_writer final
+{
+public:
+	/** Receives consecutive pieces of the document, returns false if the consumer is no longer interested in the output */
+	using sink_t = std::function<bool (std::string const &)>;
+
+	explicit json_writer (sink_t sink, std::size_t chunk_size = default_chunk_size);
+
+	void begin_object ();
+	void begin_object (std::string_view key);
+	void end_object ();
+	void begin_array ();
+	void begin_array (std::string_view key);
+	void end_array ();
+	/** Closes the innermost open object or array */
+	void end ();
+	/** Writes a string value, only valid inside an array */
+	void value (std::string_view value);
+	/** Writes a key and string value pair, only valid inside an object */
+	void value (std::string_view key, std::string_view value);
+
+	/** Passes the buffered output to the sink, the document may be continued afterwards */
+	void flush ();
+	/** Passes the remaining buffered output to the sink, @returns false if the sink rejected any output */
+	bool finish ();
+	/** True once the sink rejected output, callers should stop producing the document */
+	bool failed () const;
+	/** Number of bytes already handed to the sink */
+	std::size_t flushed () const;
+
+	static std::size_t constexpr default_chunk_size = 64 * 1024;
+
+private:
+	struct container
+	{
+		char open;
+		char close;
+		// Key of a nested container, it is only written together with the first element
+		std::optional<std::string> key;
+		bool opened{ false };
+		bool first{ true };
+	};
+
+	void begin (char open, char close, std::optional<std::string_view> key);
+	void open_container (std::size_t index);
+	void separator ();
+	void key (std::string_view key);
+	void string (std::string_view value);
+	void flush_if_full ();
+
+private:
+	sink_t sink;
+	std::size_t const chunk_size;
+	std::string buffer;
+	// One entry per object or array that has been begun but not ended
+	std::vector<container> containers;
+	std::size_t flushed_bytes{ 0 };
+	bool failed_m{ false };
+};
+}
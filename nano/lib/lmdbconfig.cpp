@@ -26,6 +26,9 @@ nano::error nano::lmdb_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("sync", sync_string, "Sync strategy for flushing commits to the ledger database. This does not affect the wallet database.\ntype:string,{always, nosync_safe, nosync_unsafe, nosync_unsafe_large_memory}");
 	toml.put ("max_databases", max_databases, "Maximum open lmdb databases. Increase default if more than 100 wallets is required.\nNote: external management is recommended when a large amounts of wallets are required (see https://docs.nano.org/integration-guides/key-management/).\ntype:uin32");
 	toml.put ("map_size", map_size, "Maximum ledger database map size in bytes.\ntype:uint64");
+	toml.put ("read_transaction_pool", read_transaction_pool, "Maximum number of finished read transactions kept for reuse by the ledger database. Reusing a transaction avoids the cost of acquiring a reader slot, but every pooled transaction keeps one reserved. 0 disables pooling.\ntype:uint64,[0..64]");
+	toml.put ("read_transaction_max_idle", read_transaction_max_idle.count (), "Pooled read transactions unused for longer than this are released.\ntype:milliseconds");
+	toml.put ("read_transaction_max_staleness", read_transaction_max_staleness.count (), "Maximum age of the snapshot seen by a long running reader. Readers periodically renew transactions older than this so they do not pin old pages in the ledger database.\ntype:milliseconds");
 	return toml.get_error ();
 }
 
@@ -34,6 +37,24 @@ nano::error nano::lmdb_config::deserialize_toml (nano::tomlconfig & toml)
 	auto default_max_databases = max_databases;
 	toml.get_optional<uint32_t> ("max_databases", max_databases);
 	toml.get_optional<size_t> ("map_size", map_size);
+	toml.get_optional<size_t> ("read_transaction_pool", read_transaction_pool);
+	auto read_transaction_max_idle_l = read_transaction_max_idle.count ();
+	toml.get_optional ("read_transaction_max_idle", read_transaction_max_idle_l);
+	read_transaction_max_idle = std::chrono::milliseconds{ read_transaction_max_idle_l };
+	auto read_transaction_max_staleness_l = read_transaction_max_staleness.count ();
+	toml.get_optional ("read_transaction_max_staleness", read_transaction_max_staleness_l);
+	read_transaction_max_staleness = std::chrono::milliseconds{ read_transaction_max_staleness_l };
+
+	// LMDB has 126 reader slots by default, pooled transactions must leave most of them for active readers
+	if (read_transaction_pool > 64)
+	{
+		toml.get_error ().set ("read_transaction_pool must be between 0 and 64");
+	}
+
+	if (read_transaction_max_staleness.count () <= 0)
+	{
+		toml.get_error ().set ("read_transaction_max_staleness must be greater than 0");
+	}
 
 	if (!toml.get_error ())
 	{
@@ -2,6 +2,7 @@
 
 #include <nano/lib/errors.hpp>
 
+#include <chrono>
 #include <thread>
 
 namespace nano
@@ -46,5 +47,11 @@ public:
 	sync_strategy sync{ always };
 	uint32_t max_databases{ 128 };
 	size_t map_size{ 256ULL * 1024 * 1024 * 1024 };
+	/** Maximum number of finished read transactions kept for reuse, each one holds on to a reader slot. 0 disables pooling */
+	size_t read_transaction_pool{ 16 };
+	/** Pooled read transactions unused for longer than this are released, freeing their reader slot */
+	std::chrono::milliseconds read_transaction_max_idle{ 1000 * 10 };
+	/** Maximum age of a read snapshot, read transactions older than this are renewed by `refresh_if_needed ()` */
+	std::chrono::milliseconds read_transaction_max_staleness{ 500 };
 };
 }
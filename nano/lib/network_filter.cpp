@@ -5,9 +5,13 @@
 #include <nano/lib/stream.hpp>
 #include <nano/secure/common.hpp>
 
+#include <algorithm>
+
 nano::network_filter::network_filter (size_t size_a, epoch_t age_cutoff_a) :
+	age_cutoff{ age_cutoff_a },
 	items (size_a, { 0 }),
-	age_cutoff{ age_cutoff_a }
+	stripe_size{ std::max<size_t> ((size_a + max_stripes - 1) / max_stripes, 1) },
+	stripes{ std::make_unique<stripe[]> ((size_a + stripe_size - 1) / stripe_size) }
 {
 	nano::random_pool::generate_block (key, key.size ());
 }
@@ -15,15 +19,13 @@ nano::network_filter::network_filter (size_t size_a, epoch_t age_cutoff_a) :
 void nano::network_filter::update (epoch_t epoch_inc)
 {
 	debug_assert (epoch_inc > 0);
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	current_epoch += epoch_inc;
+	current_epoch.fetch_add (epoch_inc);
 }
 
 bool nano::network_filter::compare (entry const & existing, digest_t const & digest) const
 {
-	debug_assert (!mutex.try_lock ());
 	// Only consider digests to be the same if the epoch is within the age cutoff
-	return existing.digest == digest && existing.epoch + age_cutoff >= current_epoch;
+	return existing.digest == digest && existing.epoch + age_cutoff >= current_epoch.load ();
 }
 
 bool nano::network_filter::apply (uint8_t const * bytes_a, size_t count_a, nano::uint128_t * digest_out)
@@ -39,14 +41,15 @@ bool nano::network_filter::apply (uint8_t const * bytes_a, size_t count_a, nano:
 
 bool nano::network_filter::apply (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
+	auto const idx = index (digest);
+	nano::lock_guard<nano::mutex> lock{ stripe_mutex (idx) };
 
-	auto & element = get_element (digest);
+	auto & element = items[idx];
 	bool existed = compare (element, digest);
 	if (!existed)
 	{
 		// Replace likely old element with a new one
-		element = { digest, current_epoch };
+		element = { digest, current_epoch.load () };
 	}
 	return existed;
 }
@@ -58,15 +61,16 @@ bool nano::network_filter::check (uint8_t const * bytes, size_t count) const
 
 bool nano::network_filter::check (digest_t const & digest) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto & element = get_element (digest);
-	return compare (element, digest);
+	auto const idx = index (digest);
+	nano::lock_guard<nano::mutex> lock{ stripe_mutex (idx) };
+	return compare (items[idx], digest);
 }
 
 void nano::network_filter::clear (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto & element = get_element (digest);
+	auto const idx = index (digest);
+	nano::lock_guard<nano::mutex> lock{ stripe_mutex (idx) };
+	auto & element = items[idx];
 	if (compare (element, digest))
 	{
 		element = { 0 };
@@ -75,14 +79,9 @@ void nano::network_filter::clear (digest_t const & digest)
 
 void nano::network_filter::clear (std::vector<digest_t> const & digests)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	for (auto const & digest : digests)
 	{
-		auto & element = get_element (digest);
-		if (compare (element, digest))
-		{
-			element = { 0 };
-		}
+		clear (digest);
 	}
 }
 
@@ -99,8 +98,12 @@ void nano::network_filter::clear (OBJECT const & object_a)
 
 void nano::network_filter::clear ()
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	items.assign (items.size (), { 0 });
+	for (size_t begin = 0; begin < items.size (); begin += stripe_size)
+	{
+		nano::lock_guard<nano::mutex> lock{ stripe_mutex (begin) };
+		auto const end = std::min (begin + stripe_size, items.size ());
+		std::fill (items.begin () + begin, items.begin () + end, entry{ 0 });
+	}
 }
 
 template <typename OBJECT>
@@ -114,20 +117,16 @@ nano::uint128_t nano::network_filter::hash (OBJECT const & object_a) const
 	return hash (bytes.data (), bytes.size ());
 }
 
-auto nano::network_filter::get_element (nano::uint128_t const & hash_a) -> entry &
+size_t nano::network_filter::index (nano::uint128_t const & hash_a) const
 {
-	debug_assert (!mutex.try_lock ());
 	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	return static_cast<size_t> (hash_a % items.size ());
 }
 
-auto nano::network_filter::get_element (nano::uint128_t const & hash_a) const -> entry const &
+nano::mutex & nano::network_filter::stripe_mutex (size_t index_a) const
 {
-	debug_assert (!mutex.try_lock ());
-	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	debug_assert (index_a < items.size ());
+	return stripes[index_a / stripe_size].mutex;
 }
 
 nano::uint128_t nano::network_filter::hash (uint8_t const * bytes_a, size_t count_a) const
@@ -7,12 +7,16 @@
 #include <cryptopp/seckey.h>
 #include <cryptopp/siphash.h>
 
+#include <atomic>
+#include <memory>
+
 namespace nano
 {
 /**
  * A probabilistic duplicate filter based on directed map caches, using SipHash 2/4/128
  * The probability of false negatives (unique packet marked as duplicate) is the probability of a 128-bit SipHash collision.
  * The probability of false positives (duplicate packet marked as unique) shrinks with a larger filter.
+ * Elements are split into contiguous stripes, each guarded by its own mutex, so that threads filtering unrelated digests rarely contend.
  * @note This class is thread-safe.
  */
 class network_filter final
@@ -84,15 +88,16 @@ public:
 	 **/
 	digest_t hash (uint8_t const * bytes, size_t count) const;
 
+	/** Upper bound on the number of independently locked stripes */
+	static size_t constexpr max_stripes = 64;
+
 private:
 	epoch_t const age_cutoff;
-	epoch_t current_epoch{ 0 };
+	std::atomic<epoch_t> current_epoch{ 0 };
 
 	using siphash_t = CryptoPP::SipHash<2, 4, true>;
 	CryptoPP::SecByteBlock key{ siphash_t::KEYLENGTH };
 
-	mutable nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
-
 private:
 	struct entry
 	{
@@ -100,15 +105,25 @@ private:
 		epoch_t epoch;
 	};
 
+	// Each stripe occupies its own cache line, so that locking one stripe doesn't invalidate its neighbours
+	struct alignas (64) stripe
+	{
+		nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
+	};
+
 	std::vector<entry> items;
+	size_t const stripe_size;
+	std::unique_ptr<stripe[]> stripes;
+
+	/**
+	 * Get index of the element corresponding to the digest
+	 **/
+	size_t index (digest_t const & hash) const;
 
 	/**
-	 * Get element from digest.
-	 * @note must have a lock on mutex
-	 * @return a reference to the element with key \p hash_a
+	 * Get mutex guarding the stripe containing element at \p index
 	 **/
-	entry & get_element (digest_t const & hash);
-	entry const & get_element (digest_t const & hash) const;
+	nano::mutex & stripe_mutex (size_t index) const;
 
 	bool compare (entry const & existing, digest_t const & digest) const;
 };
@@ -9,6 +9,7 @@
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
 
+#include <algorithm>
 #include <iostream>
 #include <cstdlib>
 
@@ -416,6 +417,73 @@ bool nano::validate_message (nano::public_key const & public_key, nano::uint256_
 	return validate_message (public_key, message.bytes.data (), sizeof (message.bytes), signature);
 }
 
+bool nano::validate_message_batch (uint8_t const ** messages, size_t * lengths, uint8_t const ** public_keys, uint8_t const ** signatures, size_t num, int * valid)
+{
+	// Single verification compares the encoded R with [S]B - [H(R,A,M)]A and rejects a non-canonical S. The batch equation reduces S modulo the group order, decodes R and only needs a random linear combination of the per-signature equations to vanish
+	// A non-canonical S, a non-canonical R or A encoding, or a small order R or A can therefore pass the batch and fail single verification, so such signatures are checked individually
+	// Neither path multiplies by the cofactor, which would accept signatures that nodes verifying one at a time reject. A mixed order R is not detected, but only the holder of the private key can produce one
+	auto non_canonical = [signatures] (size_t i) {
+		return (signatures[i][63] & 0xe0) != 0;
+	};
+	// Encodings of the small order points with the sign bit cleared, see libsodium's ge25519_has_small_order
+	static uint8_t const small_order[5][32] = {
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0, 0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05 },
+		{ 0xc7, 0x17, 0x6a, 0x70, 0x3d, 0x4d, 0xd8, 0x4f, 0xba, 0x3c, 0x0b, 0x76, 0x0d, 0x10, 0x67, 0x0f, 0x2a, 0x20, 0x53, 0xfa, 0x2c, 0x39, 0xcc, 0xc6, 0x4e, 0xc7, 0xfd, 0x77, 0x92, 0xac, 0x03, 0x7a },
+		{ 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f }
+	};
+	auto unsafe_point = [] (uint8_t const * point) {
+		std::array<uint8_t, 32> y;
+		std::copy (point, point + 32, y.begin ());
+		y[31] &= 0x7f;
+		// y >= 2^255 - 19
+		bool non_canonical = y[31] == 0x7f && y[0] >= 0xed && std::all_of (y.begin () + 1, y.begin () + 31, [] (uint8_t byte) { return byte == 0xff; });
+		return non_canonical || std::any_of (std::begin (small_order), std::end (small_order), [&y] (auto const & order) { return std::equal (y.begin (), y.end (), order); });
+	};
+
+	std::vector<size_t> batch;
+	batch.reserve (num);
+	bool result = false;
+	for (size_t i = 0; i < num; ++i)
+	{
+		if (non_canonical (i) || unsafe_point (signatures[i]) || unsafe_point (public_keys[i]))
+		{
+			valid[i] = ed25519_sign_open (messages[i], lengths[i], public_keys[i], signatures[i]) == 0 ? 1 : 0;
+			result |= valid[i] == 0;
+		}
+		else
+		{
+			batch.push_back (i);
+		}
+	}
+	if (batch.size () == num)
+	{
+		return 0 != ed25519_sign_open_batch (messages, lengths, public_keys, signatures, num, valid);
+	}
+	if (!batch.empty ())
+	{
+		std::vector<uint8_t const *> batch_messages;
+		std::vector<size_t> batch_lengths;
+		std::vector<uint8_t const *> batch_public_keys;
+		std::vector<uint8_t const *> batch_signatures;
+		std::vector<int> batch_valid (batch.size (), 0);
+		for (auto i : batch)
+		{
+			batch_messages.push_back (messages[i]);
+			batch_lengths.push_back (lengths[i]);
+			batch_public_keys.push_back (public_keys[i]);
+			batch_signatures.push_back (signatures[i]);
+		}
+		result |= 0 != ed25519_sign_open_batch (batch_messages.data (), batch_lengths.data (), batch_public_keys.data (), batch_signatures.data (), batch.size (), batch_valid.data ());
+		for (size_t j = 0; j < batch.size (); ++j)
+		{
+			valid[batch[j]] = batch_valid[j];
+		}
+	}
+	return result;
+}
+
 nano::uint128_union::uint128_union (std::string const & string_a)
 {
 	auto error (decode_hex (string_a));
@@ -506,6 +506,13 @@ nano::signature sign_message (nano::raw_key const &, nano::public_key const &, n
 nano::signature sign_message (nano::raw_key const &, nano::public_key const &, uint8_t const *, size_t);
 bool validate_message (nano::public_key const &, nano::uint256_union const &, nano::signature const &);
 bool validate_message (nano::public_key const &, uint8_t const *, size_t, nano::signature const &);
+/**
+ * Verifies `num` signatures at once using ed25519 batch verification, individual signatures are only rechecked if the batch fails
+ * Signatures with a non-canonical S are never batched and are rejected the same way as by `validate_message`
+ * @param valid Output array of size `num`, set to 1 for every valid signature and 0 otherwise
+ * @returns true if any of the signatures is invalid
+ */
+bool validate_message_batch (uint8_t const ** messages, size_t * lengths, uint8_t const ** public_keys, uint8_t const ** signatures, size_t num, int * valid);
 nano::raw_key deterministic_key (nano::raw_key const &, uint32_t);
 nano::public_key pub_key (nano::raw_key const &);
 
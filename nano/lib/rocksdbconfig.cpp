@@ -8,6 +8,17 @@ nano::error nano::rocksdb_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("io_threads", io_threads, "Number of threads to use with the background compaction and flushing.\ntype:uint32");
 	toml.put ("read_cache", read_cache, "Amount of megabytes per table allocated to read cache. Valid range is 1 - 1024. Default is 32.\nCarefully monitor memory usage if non-default values are used\ntype:long");
 	toml.put ("write_cache", write_cache, "Total amount of megabytes allocated to write cache. Valid range is 1 - 256. Default is 64.\nCarefully monitor memory usage if non-default values are used\ntype:long");
+	toml.put ("shared_read_cache", shared_read_cache, "Amount of megabytes allocated to a single read cache shared by all tables, replacing the per table read_cache. Valid range is 0 - 65536. Default is 0 (disabled).\ntype:long");
+
+	auto put_table = [&toml] (char const * name, nano::rocksdb_table_config const & table) {
+		nano::tomlconfig table_l;
+		table.serialize_toml (table_l);
+		toml.put_child (name, table_l);
+	};
+	put_table ("blocks", blocks);
+	put_table ("accounts", accounts);
+	put_table ("pending", pending);
+	put_table ("confirmation_height", confirmation_height);
 
 	return toml.get_error ();
 }
@@ -18,6 +29,19 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 	toml.get_optional<unsigned> ("io_threads", io_threads);
 	toml.get_optional<long> ("read_cache", read_cache);
 	toml.get_optional<long> ("write_cache", write_cache);
+	toml.get_optional<long> ("shared_read_cache", shared_read_cache);
+
+	auto get_table = [&toml] (char const * name, nano::rocksdb_table_config & table) {
+		if (toml.has_key (name))
+		{
+			auto table_l (toml.get_required_child (name));
+			table.deserialize_toml (table_l);
+		}
+	};
+	get_table ("blocks", blocks);
+	get_table ("accounts", accounts);
+	get_table ("pending", pending);
+	get_table ("confirmation_height", confirmation_height);
 
 	// Validate ranges
 	if (io_threads == 0)
@@ -35,6 +59,34 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 		toml.get_error ().set ("write_cache must be between 1 and 256 MB");
 	}
 
+	if (shared_read_cache < 0 || shared_read_cache > 65536)
+	{
+		toml.get_error ().set ("shared_read_cache must be between 0 and 65536 MB");
+	}
+
+	return toml.get_error ();
+}
+
+nano::error nano::rocksdb_table_config::serialize_toml (nano::tomlconfig & toml) const
+{
+	toml.put ("block_size", block_size, "Size of data blocks in kilobytes. Larger blocks shrink the index but make point lookups read more data. Valid range is 1 - 1024. Default is 4.\ntype:uint32");
+	toml.put ("partitioned_filters", partitioned_filters, "Partition index and bloom filter blocks, so that only the partitions in use have to be kept in the read cache.\ntype:bool");
+	toml.put ("pin_l0_filters", pin_l0_filters, "Keep index and bloom filter blocks of the most recently flushed files pinned in the read cache.\ntype:bool");
+
+	return toml.get_error ();
+}
+
+nano::error nano::rocksdb_table_config::deserialize_toml (nano::tomlconfig & toml)
+{
+	toml.get_optional<unsigned> ("block_size", block_size);
+	toml.get_optional<bool> ("partitioned_filters", partitioned_filters);
+	toml.get_optional<bool> ("pin_l0_filters", pin_l0_filters);
+
+	if (block_size < 1 || block_size > 1024)
+	{
+		toml.get_error ().set ("block_size must be between 1 and 1024 KB");
+	}
+
 	return toml.get_error ();
 }
 
@@ -9,6 +9,21 @@ namespace nano
 {
 class tomlconfig;
 
+/** Table (column family) specific options for RocksDB */
+class rocksdb_table_config final
+{
+public:
+	nano::error serialize_toml (nano::tomlconfig &) const;
+	nano::error deserialize_toml (nano::tomlconfig &);
+
+	/** Size of uncompressed data blocks, in kilobytes */
+	unsigned block_size{ 4 };
+	/** Split index and filter blocks into smaller partitions that are cached individually */
+	bool partitioned_filters{ false };
+	/** Keep index and filter blocks of level 0 files in the block cache */
+	bool pin_l0_filters{ false };
+};
+
 /** Configuration options for RocksDB */
 class rocksdb_config final
 {
@@ -28,5 +43,13 @@ public:
 	unsigned io_threads{ std::max (nano::hardware_concurrency () / 2, 1u) };
 	long read_cache{ 32 };
 	long write_cache{ 64 };
+	/** Size of a single read cache shared by all tables in megabytes, 0 gives each table its own `read_cache` sized cache */
+	long shared_read_cache{ 0 };
+
+	/** Tuning for the largest tables */
+	nano::rocksdb_table_config blocks;
+	nano::rocksdb_table_config accounts;
+	nano::rocksdb_table_config pending;
+	nano::rocksdb_table_config confirmation_height;
 };
 }
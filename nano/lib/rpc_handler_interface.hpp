@@ -55,9 +55,26 @@ public:
 class rpc_handler_interface
 {
 public:
+	/**
+	 * Receives the next piece of a chunked response body, the last piece is flagged.
+	 * Queuing never waits for the client. Unless `last` is set, `next` is called once the client is ready for more output,
+	 * or with false if the response can no longer be delivered, and the next piece must not be produced before that.
+	 */
+	using chunk_t = std::function<void (std::string const & data, bool last, std::function<void (bool)> next)>;
+
 	virtual ~rpc_handler_interface () = default;
 	/** Process RPC 1.0 request. */
 	virtual void process_request (std::string const & action, std::string const & body, std::function<void (std::string const &)> response) = 0;
+	/**
+	 * Process RPC 1.0 request, delivering the response as consecutive chunks of the body.
+	 * Handlers that cannot stream deliver the whole response as a single last chunk.
+	 */
+	virtual void process_request_chunked (std::string const & action, std::string const & body, chunk_t chunk)
+	{
+		process_request (action, body, [chunk] (std::string const & response) {
+			chunk (response, true, nullptr);
+		});
+	}
 	/** Process RPC 2.0 request. This is called via the IPC API */
 	virtual void process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body, std::function<void (std::shared_ptr<std::string> const &)> response) = 0;
 	virtual void stop () = 0;
@@ -31,6 +31,7 @@ std::string nano::stat_log_sink::tm_to_string (tm & tm)
  */
 
 nano::stats::stats (nano::logger & logger_a, nano::stats_config config_a) :
+	counters (type_count * detail_count * dir_count),
 	config{ std::move (config_a) },
 	logger{ logger_a },
 	enable_logging{ is_stat_logging_enabled () }
@@ -72,7 +73,10 @@ void nano::stats::stop ()
 void nano::stats::clear ()
 {
 	std::lock_guard guard{ mutex };
-	counters.clear ();
+	for (auto & counter : counters)
+	{
+		counter.store (0, std::memory_order_relaxed);
+	}
 	samplers.clear ();
 	timestamp = std::chrono::steady_clock::now ();
 }
@@ -96,71 +100,27 @@ void nano::stats::add (stat::type type, stat::detail detail, stat::dir dir, coun
 		value);
 	}
 
-	// Updates need to happen while holding the mutex
-	auto update_counter = [this, aggregate_all] (nano::stats::counter_key key, auto && updater) {
-		counter_key all_key{ key.type, stat::detail::all, key.dir };
-
-		// This is a two-step process to avoid exclusively locking the mutex in the common case
-		{
-			std::shared_lock lock{ mutex };
-
-			if (auto it = counters.find (key); it != counters.end ())
-			{
-				updater (*it->second);
-
-				if (aggregate_all && key != all_key)
-				{
-					auto it_all = counters.find (all_key);
-					release_assert (it_all != counters.end ()); // The `all` counter should always be created together
-					updater (*it_all->second); // Also update the `all` counter
-				}
-
-				return;
-			}
-		}
-		// Not found, create a new entry
-		{
-			std::unique_lock lock{ mutex };
-
-			// Insertions will be ignored if the key already exists
-			auto [it, inserted] = counters.emplace (key, std::make_unique<counter_entry> ());
-			updater (*it->second);
-
-			if (aggregate_all && key != all_key)
-			{
-				auto [it_all, inserted_all] = counters.emplace (all_key, std::make_unique<counter_entry> ());
-				updater (*it_all->second); // Also update the `all` counter
-			}
-		}
-	};
-
-	update_counter (counter_key{ type, detail, dir }, [value] (counter_entry & counter) {
-		counter.value += value;
-	});
+	counters[counter_index (type, detail, dir)].fetch_add (value, std::memory_order_relaxed);
+	if (aggregate_all && detail != stat::detail::all)
+	{
+		counters[counter_index (type, stat::detail::all, dir)].fetch_add (value, std::memory_order_relaxed); // Also update the `all` counter
+	}
 }
 
 nano::stats::counter_value_t nano::stats::count (stat::type type, stat::detail detail, stat::dir dir) const
 {
-	std::shared_lock lock{ mutex };
-	if (auto it = counters.find (counter_key{ type, detail, dir }); it != counters.end ())
-	{
-		return it->second->value;
-	}
-	return 0;
+	return counters[counter_index (type, detail, dir)].load (std::memory_order_relaxed);
 }
 
 nano::stats::counter_value_t nano::stats::count (stat::type type, stat::dir dir) const
 {
-	std::shared_lock lock{ mutex };
 	counter_value_t result = 0;
-	auto it = counters.lower_bound (counter_key{ type, stat::detail::all, dir });
-	while (it != counters.end () && it->first.type == type)
+	for (size_t detail = 0; detail < detail_count; ++detail)
 	{
-		if (it->first.dir == dir && it->first.detail != stat::detail::all)
+		if (static_cast<stat::detail> (detail) != stat::detail::all)
 		{
-			result += it->second->value;
+			result += counters[counter_index (type, static_cast<stat::detail> (detail), dir)].load (std::memory_order_relaxed);
 		}
-		++it;
 	}
 	return result;
 }
@@ -236,13 +196,19 @@ void nano::stats::log_counters_impl (stat_log_sink & sink, tm & tm)
 		sink.write_header ("counters", walltime);
 	}
 
-	for (auto const & [key, entry] : counters)
+	for (size_t index = 0; index < counters.size (); ++index)
 	{
-		std::string type{ to_string (key.type) };
-		std::string detail{ to_string (key.detail) };
-		std::string dir{ to_string (key.dir) };
+		auto const value = counters[index].load (std::memory_order_relaxed);
+		if (value == 0)
+		{
+			continue;
+		}
+
+		std::string type{ to_string (static_cast<stat::type> (index / (detail_count * dir_count))) };
+		std::string detail{ to_string (static_cast<stat::detail> (index / dir_count % detail_count)) };
+		std::string dir{ to_string (static_cast<stat::dir> (index % dir_count)) };
 
-		sink.write_counter_entry (tm, type, detail, dir, entry->value);
+		sink.write_counter_entry (tm, type, detail, dir, value);
 	}
 	sink.entries ()++;
 	sink.finalize ();
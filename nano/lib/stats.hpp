@@ -7,6 +7,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <initializer_list>
 #include <map>
@@ -64,6 +65,7 @@ class stat_log_sink;
  * Collects counts and samples for inbound and outbound traffic, blocks, errors, and so on.
  * Stats can be queried and observed on a type level (such as message and ledger) as well as a more
  * specific detail level (such as send blocks)
+ * Counters are kept in a dense table indexed by type, detail and direction, so updating a counter doesn't require any locking or lookups
  */
 class stats final
 {
@@ -132,15 +134,6 @@ public:
 	std::string dump (category category = category::counters);
 
 private:
-	struct counter_key
-	{
-		stat::type type;
-		stat::detail detail;
-		stat::dir dir;
-
-		auto operator<=> (const counter_key &) const = default;
-	};
-
 	struct sampler_key
 	{
 		stat::sample sample;
@@ -149,18 +142,6 @@ private:
 	};
 
 private:
-	class counter_entry
-	{
-	public:
-		// Prevent copying
-		counter_entry () = default;
-		counter_entry (counter_entry const &) = delete;
-		counter_entry & operator= (counter_entry const &) = delete;
-
-	public:
-		std::atomic<counter_value_t> value{ 0 };
-	};
-
 	class sampler_entry
 	{
 	public:
@@ -183,9 +164,18 @@ private:
 		mutable nano::mutex mutex;
 	};
 
-	// Wrap in unique_ptrs because mutex/atomic members are not movable
-	// TODO: Compare performance of map vs unordered_map
-	std::map<counter_key, std::unique_ptr<counter_entry>> counters;
+	static constexpr size_t type_count = static_cast<size_t> (stat::type::_last);
+	static constexpr size_t detail_count = static_cast<size_t> (stat::detail::_last);
+	static constexpr size_t dir_count = static_cast<size_t> (stat::dir::_last);
+
+	static constexpr size_t counter_index (stat::type type, stat::detail detail, stat::dir dir)
+	{
+		return (static_cast<size_t> (type) * detail_count + static_cast<size_t> (detail)) * dir_count + static_cast<size_t> (dir);
+	}
+
+	// Counters for every type/detail/dir combination, a counter that was never updated is zero and is omitted from logs
+	std::vector<std::atomic<counter_value_t>> counters;
+	// Wrap in unique_ptrs because mutex members are not movable
 	std::map<sampler_key, std::unique_ptr<sampler_entry>> samplers;
 
 private:
@@ -113,6 +113,11 @@ enum class type
 	message_processor_type,
 	process_confirmed,
 	online_reps,
+	signature_checker,
+	block_cache,
+	websocket_send,
+	websocket_send_bytes,
+	websocket_drop,
 
 	_last // Must be the last enum
 };
@@ -210,6 +215,8 @@ enum class detail
 	process_blocking,
 	process_blocking_timeout,
 	force,
+	prevalidation_old,
+	prevalidation_rejected,
 
 	// block source
 	live,
@@ -318,6 +325,9 @@ enum class detail
 	reachout_live,
 	reachout_cached,
 	connected,
+	flood,
+	flood_bytes_serialized,
+	flood_bytes_sent,
 
 	// traffic type
 	generic,
@@ -386,6 +396,7 @@ enum class detail
 	blocks_confirmed,
 	blocks_confirmed_unbounded,
 	blocks_confirmed_bounded,
+	plan_invalid,
 
 	// request aggregator
 	aggregator_accepted,
@@ -428,6 +439,7 @@ enum class detail
 	generator_replies,
 	generator_replies_discarded,
 	generator_spacing,
+	generator_signed_parallel,
 
 	// hinting
 	missing_block,
@@ -468,6 +480,7 @@ enum class detail
 	put,
 	satisfied,
 	trigger,
+	spill,
 
 	// election scheduler
 	insert_manual,
@@ -579,6 +592,8 @@ enum class detail
 	cemented_hash,
 	cementing_failed,
 	deferred_failed,
+	planned,
+	cemented_planned,
 
 	// election_state
 	passive,
@@ -619,6 +634,19 @@ enum class detail
 	rep_update,
 	update_online,
 
+	// block_cache
+	hit,
+	miss,
+	stale,
+
+	// websocket
+	ack,
+	confirmation,
+	started_election,
+	stopped_election,
+	work,
+	new_unconfirmed_block,
+
 	// error codes
 	no_buffer_space,
 	timed_out,
@@ -646,6 +674,8 @@ enum class sample
 	rep_response_time,
 	vote_generator_final_hashes,
 	vote_generator_hashes,
+	vote_generator_final_latency,
+	vote_generator_latency,
 
 	_last // Must be the last enum
 };
@@ -43,6 +43,9 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::block_processing_notifications:
 			thread_role_name_string = "Blck proc notif";
 			break;
+		case nano::thread_role::name::block_prevalidation:
+			thread_role_name_string = "Blck prevalid";
+			break;
 		case nano::thread_role::name::request_loop:
 			thread_role_name_string = "Request loop";
 			break;
@@ -73,6 +76,9 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::confirmation_height_notifications:
 			thread_role_name_string = "Conf notif";
 			break;
+		case nano::thread_role::name::confirmation_height_planning:
+			thread_role_name_string = "Conf plan";
+			break;
 		case nano::thread_role::name::worker:
 			thread_role_name_string = "Worker";
 			break;
@@ -112,6 +118,9 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::vote_generator_queue:
 			thread_role_name_string = "Voting que";
 			break;
+		case nano::thread_role::name::vote_signing:
+			thread_role_name_string = "Vote signing";
+			break;
 		case nano::thread_role::name::bootstrap:
 			thread_role_name_string = "Bootstrap";
 			break;
@@ -19,6 +19,7 @@ enum class name
 	vote_cache_processing,
 	block_processing,
 	block_processing_notifications,
+	block_prevalidation,
 	request_loop,
 	wallet_actions,
 	bootstrap_initiator,
@@ -29,6 +30,7 @@ enum class name
 	rpc_process_container,
 	confirmation_height,
 	confirmation_height_notifications,
+	confirmation_height_planning,
 	worker,
 	wallet_worker,
 	election_worker,
@@ -42,6 +44,7 @@ enum class name
 	bounded_backlog_scan,
 	bounded_backlog_notifications,
 	vote_generator_queue,
+	vote_signing,
 	telemetry,
 	bootstrap,
 	bootstrap_database_scan,
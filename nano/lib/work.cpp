@@ -1,4 +1,3 @@
-#include <nano/crypto/blake2/blake2.h>
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/constants.hpp>
@@ -6,9 +5,13 @@
 #include <nano/lib/thread_roles.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/work.hpp>
+#include <nano/lib/work_kernels.hpp>
 #include <nano/lib/work_version.hpp>
 #include <nano/node/xorshift.hpp>
 
+#include <boost/endian/conversion.hpp>
+
+#include <array>
 #include <future>
 
 std::string nano::to_string (nano::work_version const version_a)
@@ -67,8 +70,10 @@ void nano::work_pool::loop (uint64_t thread)
 	nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (rng.s.data ()), rng.s.size () * sizeof (decltype (rng.s)::value_type));
 	uint64_t work;
 	uint64_t output;
-	blake2b_state hash;
-	blake2b_init (&hash, sizeof (output));
+	// Widest blake2b kernel supported by this CPU, hashes a batch of nonces at once
+	auto const kernel = nano::work_kernels::get ();
+	std::array<uint64_t, nano::work_kernels::batch_size> nonces;
+	std::array<uint64_t, nano::work_kernels::batch_size> outputs;
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	auto pow_sleep = pow_rate_limiter;
 	while (!done)
@@ -97,20 +102,36 @@ void nano::work_pool::loop (uint64_t thread)
 			}
 			else
 			{
+				// Kernels take the root as little endian message words
+				std::array<uint64_t, 4> root;
+				for (auto i (0u); i < root.size (); ++i)
+				{
+					root[i] = boost::endian::load_little_u64 (current_l.item.bytes.data () + i * sizeof (uint64_t));
+				}
 				// ticket != ticket_l indicates a different thread found a solution and we should stop
 				while (ticket == ticket_l && output < current_l.difficulty)
 				{
 					// Don't query main memory every iteration in order to reduce memory bus traffic
 					// All operations here operate on stack memory
 					// Count iterations down to zero since comparing to zero is easier than comparing to another number
-					unsigned iteration (256);
+					unsigned iteration (256 / nano::work_kernels::batch_size);
 					while (iteration && output < current_l.difficulty)
 					{
-						work = rng.next ();
-						blake2b_update (&hash, reinterpret_cast<uint8_t *> (&work), sizeof (work));
-						blake2b_update (&hash, current_l.item.bytes.data (), current_l.item.bytes.size ());
-						blake2b_final (&hash, reinterpret_cast<uint8_t *> (&output), sizeof (output));
-						blake2b_init (&hash, sizeof (output));
+						for (auto & nonce : nonces)
+						{
+							nonce = boost::endian::native_to_little (rng.next ());
+						}
+						kernel (root.data (), nonces.data (), outputs.data ());
+						for (auto i (0u); i < outputs.size (); ++i)
+						{
+							auto const value = boost::endian::native_to_little (outputs[i]);
+							if (value >= current_l.difficulty)
+							{
+								work = boost::endian::little_to_native (nonces[i]);
+								output = value;
+								break;
+							}
+						}
 						iteration -= 1;
 					}
 
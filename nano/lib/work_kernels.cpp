@@ -0,0 +1,121 @@
+#include <nano/lib/work_kernels.hpp>
+
+#include <initializer_list>
+
+namespace
+{
+struct scalar_ops
+{
+	using vector = uint64_t;
+
+	static vector set1 (uint64_t value)
+	{
+		return value;
+	}
+	static vector add (vector a, vector b)
+	{
+		return a + b;
+	}
+	static vector bit_xor (vector a, vector b)
+	{
+		return a ^ b;
+	}
+	template <int N>
+	static vector rotr (vector a)
+	{
+		return (a >> N) | (a << (64 - N));
+	}
+};
+}
+
+void nano::work_kernels::portable (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	for (std::size_t i = 0; i < batch_size; ++i)
+	{
+		uint64_t const m[message_words] = { nonces[i], root[0], root[1], root[2], root[3] };
+		values[i] = compress<scalar_ops> (m);
+	}
+}
+
+#if defined(NANO_WORK_KERNELS_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+
+namespace
+{
+// Bits 1, 2 (SSE and AVX state) and, for AVX-512, bits 5 to 7 (opmask and upper ZMM state) must be enabled by the operating system
+bool supports_msvc (int leaf7_ebx_bit, unsigned long long xcr0_mask)
+{
+	int info[4];
+	__cpuid (info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+	__cpuid (info, 1);
+	bool const osxsave = (info[2] & (1 << 27)) != 0;
+	if (!osxsave || (_xgetbv (0) & xcr0_mask) != xcr0_mask)
+	{
+		return false;
+	}
+	__cpuidex (info, 7, 0);
+	return (info[1] & (1 << leaf7_ebx_bit)) != 0;
+}
+}
+#endif
+
+bool nano::work_kernels::supported (kernel_type type)
+{
+	switch (type)
+	{
+		case kernel_type::portable:
+			return true;
+#if defined(NANO_WORK_KERNELS_X86) && defined(_MSC_VER)
+		case kernel_type::avx2:
+			return supports_msvc (5, 0x6);
+		case kernel_type::avx512:
+			return supports_msvc (16, 0xe6);
+#elif defined(NANO_WORK_KERNELS_X86)
+		case kernel_type::avx2:
+			return __builtin_cpu_supports ("avx2");
+		case kernel_type::avx512:
+			return __builtin_cpu_supports ("avx512f");
+#endif
+		default:
+			return false;
+	}
+}
+
+nano::work_kernels::kernel_type nano::work_kernels::best ()
+{
+	static kernel_type const result = [] () {
+		for (auto type : { kernel_type::avx512, kernel_type::avx2 })
+		{
+			if (supported (type))
+			{
+				return type;
+			}
+		}
+		return kernel_type::portable;
+	}();
+	return result;
+}
+
+nano::work_kernels::kernel_t nano::work_kernels::get (kernel_type type)
+{
+	if (supported (type))
+	{
+		switch (type)
+		{
+#if defined(NANO_WORK_KERNELS_X86)
+			case kernel_type::avx2:
+				return avx2;
+			case kernel_type::avx512:
+				return avx512;
+#endif
+			default:
+				break;
+		}
+	}
+	return portable;
+}
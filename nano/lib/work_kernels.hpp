@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/*
+ * Blake2b compression specialized for work values. The hashed message is always an 8 byte nonce followed by a 32 byte root,
+ * which fits a single block, so the block is compressed once with the message words past the root known to be zero.
+ * Kernels for specific instruction sets are compiled in their own translation units with the matching compiler flags,
+ * this header must stay free of anything that could be instantiated differently between them.
+ */
+namespace nano::work_kernels
+{
+/** Number of nonces hashed by each kernel call */
+std::size_t constexpr batch_size = 8;
+
+/**
+ * Each kernel computes the work values of `batch_size` nonces for the root given as four little endian message words
+ * Nonces and values are message words, identical to the native values on little endian platforms
+ */
+void portable (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+void avx2 (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+void avx512 (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+
+using kernel_t = void (*) (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+
+enum class kernel_type
+{
+	portable,
+	avx2,
+	avx512,
+};
+
+/** True if the kernel is compiled in and the CPU and operating system support its instruction set */
+bool supported (kernel_type);
+/** Widest supported kernel, detected once */
+kernel_type best ();
+/** The portable kernel is returned for unsupported types */
+kernel_t get (kernel_type = best ());
+
+inline constexpr uint64_t iv[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+inline constexpr uint8_t sigma[12][16] = {
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+	{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+	{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+	{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+	{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+	{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+	{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+	{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+	{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+};
+
+/** Digest length 8, no key, fanout and depth 1 */
+uint64_t constexpr parameter_block = 0x01010008ULL;
+/** Bytes hashed, the nonce and the root */
+uint64_t constexpr message_length = 40;
+/** Only the nonce and the four root words are non zero */
+std::size_t constexpr message_words = 5;
+
+namespace detail
+{
+	/**
+	 * Blake2b mixing function, additions of message words known to be zero are skipped
+	 * `Ops` provides the lane type and its operations, each kernel defines its own with internal linkage
+	 */
+	template <typename Ops, std::size_t X, std::size_t Y>
+	inline void mix (typename Ops::vector & a, typename Ops::vector & b, typename Ops::vector & c, typename Ops::vector & d, typename Ops::vector const * m)
+	{
+		a = Ops::add (a, b);
+		if constexpr (X < message_words)
+		{
+			a = Ops::add (a, m[X]);
+		}
+		d = Ops::template rotr<32> (Ops::bit_xor (d, a));
+		c = Ops::add (c, d);
+		b = Ops::template rotr<24> (Ops::bit_xor (b, c));
+		a = Ops::add (a, b);
+		if constexpr (Y < message_words)
+		{
+			a = Ops::add (a, m[Y]);
+		}
+		d = Ops::template rotr<16> (Ops::bit_xor (d, a));
+		c = Ops::add (c, d);
+		b = Ops::template rotr<63> (Ops::bit_xor (b, c));
+	}
+
+	template <typename Ops, std::size_t R>
+	inline void round (typename Ops::vector * v, typename Ops::vector const * m)
+	{
+		mix<Ops, sigma[R][0], sigma[R][1]> (v[0], v[4], v[8], v[12], m);
+		mix<Ops, sigma[R][2], sigma[R][3]> (v[1], v[5], v[9], v[13], m);
+		mix<Ops, sigma[R][4], sigma[R][5]> (v[2], v[6], v[10], v[14], m);
+		mix<Ops, sigma[R][6], sigma[R][7]> (v[3], v[7], v[11], v[15], m);
+		mix<Ops, sigma[R][8], sigma[R][9]> (v[0], v[5], v[10], v[15], m);
+		mix<Ops, sigma[R][10], sigma[R][11]> (v[1], v[6], v[11], v[12], m);
+		mix<Ops, sigma[R][12], sigma[R][13]> (v[2], v[7], v[8], v[13], m);
+		mix<Ops, sigma[R][14], sigma[R][15]> (v[3], v[4], v[9], v[14], m);
+	}
+
+	template <typename Ops, std::size_t... R>
+	inline void rounds (typename Ops::vector * v, typename Ops::vector const * m, std::index_sequence<R...>)
+	{
+		(round<Ops, R> (v, m), ...);
+	}
+}
+
+/**
+ * Compresses the single message block of each lane and returns the first word of the digest, which is the work value
+ * @param m the nonce followed by the four root words
+ */
+template <typename Ops>
+inline typename Ops::vector compress (typename Ops::vector const * m)
+{
+	typename Ops::vector v[16] = {
+		Ops::set1 (iv[0] ^ parameter_block), Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+		Ops::set1 (iv[4]), Ops::set1 (iv[5]), Ops::set1 (iv[6]), Ops::set1 (iv[7]),
+		Ops::set1 (iv[0]), Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+		Ops::set1 (iv[4] ^ message_length), Ops::set1 (iv[5]), Ops::set1 (~iv[6]), Ops::set1 (iv[7])
+	};
+	detail::rounds<Ops> (v, m, std::make_index_sequence<12>{});
+	return Ops::bit_xor (Ops::set1 (iv[0] ^ parameter_block), Ops::bit_xor (v[0], v[8]));
+}
+}
@@ -0,0 +1,61 @@
+#include <nano/lib/work_kernels.hpp>
+
+#include <immintrin.h>
+
+namespace
+{
+struct avx2_ops
+{
+	using vector = __m256i;
+
+	static vector set1 (uint64_t value)
+	{
+		return _mm256_set1_epi64x (static_cast<long long> (value));
+	}
+	static vector add (vector a, vector b)
+	{
+		return _mm256_add_epi64 (a, b);
+	}
+	static vector bit_xor (vector a, vector b)
+	{
+		return _mm256_xor_si256 (a, b);
+	}
+	template <int N>
+	static vector rotr (vector a)
+	{
+		if constexpr (N == 32)
+		{
+			return _mm256_shuffle_epi32 (a, _MM_SHUFFLE (2, 3, 0, 1));
+		}
+		else if constexpr (N == 24)
+		{
+			return _mm256_shuffle_epi8 (a, _mm256_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10));
+		}
+		else if constexpr (N == 16)
+		{
+			return _mm256_shuffle_epi8 (a, _mm256_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9));
+		}
+		else if constexpr (N == 63)
+		{
+			return _mm256_xor_si256 (_mm256_srli_epi64 (a, 63), _mm256_add_epi64 (a, a));
+		}
+		else
+		{
+			return _mm256_or_si256 (_mm256_srli_epi64 (a, N), _mm256_slli_epi64 (a, 64 - N));
+		}
+	}
+};
+}
+
+void nano::work_kernels::avx2 (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	// Four nonces per vector, the root words are the same in every lane
+	for (std::size_t i = 0; i < batch_size; i += 4)
+	{
+		__m256i const m[message_words] = {
+			_mm256_loadu_si256 (reinterpret_cast<__m256i const *> (nonces + i)),
+			avx2_ops::set1 (root[0]), avx2_ops::set1 (root[1]), avx2_ops::set1 (root[2]), avx2_ops::set1 (root[3])
+		};
+		_mm256_storeu_si256 (reinterpret_cast<__m256i *> (values + i), compress<avx2_ops> (m));
+	}
+}
@@ -0,0 +1,40 @@
+#include <nano/lib/work_kernels.hpp>
+
+#include <immintrin.h>
+
+namespace
+{
+struct avx512_ops
+{
+	using vector = __m512i;
+
+	static vector set1 (uint64_t value)
+	{
+		return _mm512_set1_epi64 (static_cast<long long> (value));
+	}
+	static vector add (vector a, vector b)
+	{
+		return _mm512_add_epi64 (a, b);
+	}
+	static vector bit_xor (vector a, vector b)
+	{
+		return _mm512_xor_si512 (a, b);
+	}
+	template <int N>
+	static vector rotr (vector a)
+	{
+		return _mm512_ror_epi64 (a, N);
+	}
+};
+}
+
+void nano::work_kernels::avx512 (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	// All nonces fit a single vector, the root words are the same in every lane
+	static_assert (batch_size == 8);
+	__m512i const m[message_words] = {
+		_mm512_loadu_si512 (nonces),
+		avx512_ops::set1 (root[0]), avx512_ops::set1 (root[1]), avx512_ops::set1 (root[2]), avx512_ops::set1 (root[3])
+	};
+	_mm512_storeu_si512 (values, compress<avx512_ops> (m));
+}
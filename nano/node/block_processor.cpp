@@ -7,6 +7,7 @@
 #include <nano/node/block_processor.hpp>
 #include <nano/node/local_vote_history.hpp>
 #include <nano/node/node.hpp>
+#include <nano/node/signature_checker.hpp>
 #include <nano/node/unchecked_map.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
@@ -18,11 +19,12 @@
  * block_processor
  */
 
-nano::block_processor::block_processor (nano::node_config const & node_config, nano::ledger & ledger_a, nano::unchecked_map & unchecked_a, nano::stats & stats_a, nano::logger & logger_a) :
+nano::block_processor::block_processor (nano::node_config const & node_config, nano::ledger & ledger_a, nano::unchecked_map & unchecked_a, nano::signature_checker & signature_checker_a, nano::stats & stats_a, nano::logger & logger_a) :
 	config{ node_config.block_processor },
 	network_params{ node_config.network_params },
 	ledger{ ledger_a },
 	unchecked{ unchecked_a },
+	signature_checker{ signature_checker_a },
 	stats{ stats_a },
 	logger{ logger_a },
 	workers{ 1, nano::thread_role::name::block_processing_notifications }
@@ -65,15 +67,25 @@ nano::block_processor::~block_processor ()
 {
 	// Thread must be stopped before destruction
 	debug_assert (!thread.joinable ());
+	debug_assert (prevalidation_threads.empty ());
 	debug_assert (!workers.alive ());
 }
 
 void nano::block_processor::start ()
 {
 	debug_assert (!thread.joinable ());
+	debug_assert (prevalidation_threads.empty ());
 
 	workers.start ();
 
+	for (size_t i = 0; i < std::max<size_t> (config.prevalidation_threads, 1); ++i)
+	{
+		prevalidation_threads.emplace_back ([this] () {
+			nano::thread_role::set (nano::thread_role::name::block_prevalidation);
+			run_prevalidation ();
+		});
+	}
+
 	thread = std::thread ([this] () {
 		nano::thread_role::set (nano::thread_role::name::block_processing);
 		run ();
@@ -87,6 +99,11 @@ void nano::block_processor::stop ()
 		stopped = true;
 	}
 	condition.notify_all ();
+	for (auto & prevalidation_thread : prevalidation_threads)
+	{
+		prevalidation_thread.join ();
+	}
+	prevalidation_threads.clear ();
 	if (thread.joinable ())
 	{
 		thread.join ();
@@ -98,7 +115,8 @@ void nano::block_processor::stop ()
 std::size_t nano::block_processor::size () const
 {
 	nano::unique_lock<nano::mutex> lock{ mutex };
-	return queue.size ();
+	// Include blocks that were already taken from the queue but are not yet processed
+	return queue.size () + pipeline_size;
 }
 
 std::size_t nano::block_processor::size (nano::block_source source) const
@@ -109,12 +127,7 @@ std::size_t nano::block_processor::size (nano::block_source source) const
 
 bool nano::block_processor::add (std::shared_ptr<nano::block> const & block, block_source const source, std::shared_ptr<nano::transport::channel> const & channel, std::function<void (nano::block_status)> callback)
 {
-	if (network_params.work.validate_entry (*block)) // true => error
-	{
-		stats.inc (nano::stat::type::block_processor, nano::stat::detail::insufficient_work);
-		return false; // Not added
-	}
-
+	// Work is checked by the pre-validation threads, network messages with insufficient work are already dropped when deserialized
 	stats.inc (nano::stat::type::block_processor, nano::stat::detail::process);
 	logger.debug (nano::log::type::block_processor, "Processing block (async): {} (source: {} {})",
 	block->hash ().to_string (),
@@ -210,7 +223,7 @@ void nano::block_processor::run ()
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	while (!stopped)
 	{
-		if (!queue.empty ())
+		if (batch_ready ())
 		{
 			// It's possible that ledger processing happens faster than the notifications can be processed by other components, cooldown here
 			while (workers.queued_tasks () >= config.max_queued_notifications)
@@ -234,6 +247,9 @@ void nano::block_processor::run ()
 			debug_assert (!lock.owns_lock ());
 			lock.lock ();
 
+			debug_assert (pipeline_size >= processed.size ());
+			pipeline_size -= processed.size ();
+
 			// Queue notifications to be dispatched in the background
 			workers.post ([this, processed = std::move (processed)] () mutable {
 				stats.inc (nano::stat::type::block_processor, nano::stat::detail::notify);
@@ -252,12 +268,54 @@ void nano::block_processor::run ()
 		else
 		{
 			condition.wait (lock, [this] {
-				return stopped || !queue.empty ();
+				return stopped || batch_ready ();
+			});
+		}
+	}
+}
+
+void nano::block_processor::run_prevalidation ()
+{
+	nano::unique_lock<nano::mutex> lock{ mutex };
+	while (!stopped)
+	{
+		if (prevalidation_ready ())
+		{
+			// Reserve the position of the batch, references to deque elements stay valid while other batches are added and removed
+			auto & batch = validated.emplace_back ();
+			batch.blocks = next_batch (config.batch_size);
+			pipeline_size += batch.blocks.size ();
+			lock.unlock ();
+
+			prevalidate (batch.blocks);
+
+			lock.lock ();
+			batch.ready = true;
+			condition.notify_all ();
+		}
+		else
+		{
+			condition.wait (lock, [this] {
+				return stopped || prevalidation_ready ();
 			});
 		}
 	}
 }
 
+bool nano::block_processor::prevalidation_ready () const
+{
+	debug_assert (!mutex.try_lock ());
+	// Stay at most a few batches ahead of the ledger writer, so that queue priorities still apply to blocks waiting for processing
+	return !queue.empty () && validated.size () < config.prevalidation_threads + max_validated_batches;
+}
+
+bool nano::block_processor::batch_ready () const
+{
+	debug_assert (!mutex.try_lock ());
+	// Batches are applied in queue order, a batch that finished pre-validation waits for the ones taken before it
+	return !validated.empty () && validated.front ().ready;
+}
+
 auto nano::block_processor::next () -> context
 {
 	debug_assert (!mutex.try_lock ());
@@ -292,12 +350,16 @@ auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
+	debug_assert (batch_ready ());
 
-	auto batch = next_batch (config.batch_size);
+	auto batch = std::move (validated.front ().blocks);
+	validated.pop_front ();
 
 	lock.unlock ();
 
+	// Pre-validation can continue with the next batch while this one is being written
+	condition.notify_all ();
+
 	auto transaction = ledger.tx_begin_write (nano::store::writer::block_processor);
 
 	nano::timer<std::chrono::milliseconds> timer;
@@ -335,11 +397,95 @@ auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock
 	return processed;
 }
 
+void nano::block_processor::prevalidate (std::deque<context> & batch)
+{
+	std::vector<context *> targets;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	std::vector<nano::public_key> signers;
+	{
+		auto transaction = ledger.tx_begin_read ();
+		for (auto & ctx : batch)
+		{
+			// Computes and caches the block hash, so that it doesn't need to be done while holding the write lock
+			auto const hash = ctx.block->hash ();
+
+			if (network_params.work.validate_entry (*ctx.block)) // true => error
+			{
+				stats.inc (nano::stat::type::block_processor, nano::stat::detail::insufficient_work);
+				ctx.rejected = nano::block_status::insufficient_work;
+				continue;
+			}
+			// Blocks that are already in the ledger are rejected as old before their signature is checked, there is no need to verify them
+			if (ledger.any.block_exists_or_pruned (transaction, hash))
+			{
+				stats.inc (nano::stat::type::block_processor, nano::stat::detail::prevalidation_old);
+				continue;
+			}
+			if (auto signer = expected_signer (transaction, *ctx.block))
+			{
+				targets.push_back (&ctx);
+				blocks.push_back (ctx.block);
+				signers.push_back (*signer);
+			}
+		}
+	}
+
+	auto const invalid = signature_checker.verify (blocks, signers);
+	for (std::size_t i = 0; i < targets.size (); ++i)
+	{
+		auto & ctx = *targets[i];
+		if (!invalid[i])
+		{
+			ctx.verified_signer = signers[i];
+		}
+		// The ledger checks signatures of open and non-epoch state blocks right after checking for duplicates, so the result is known without taking the write lock
+		// Other blocks are checked again by the ledger, which handles ambiguous signers (e.g. epoch links) and produces the error code
+		else if (ctx.block->type () == nano::block_type::open || (ctx.block->type () == nano::block_type::state && !ledger.is_epoch_link (ctx.block->link_field ().value ())))
+		{
+			stats.inc (nano::stat::type::block_processor, nano::stat::detail::prevalidation_rejected);
+			ctx.rejected = nano::block_status::bad_signature;
+		}
+	}
+}
+
+std::optional<nano::public_key> nano::block_processor::expected_signer (secure::transaction const & transaction, nano::block const & block) const
+{
+	switch (block.type ())
+	{
+		case nano::block_type::state:
+		{
+			auto const link = block.link_field ().value ();
+			// Blocks with epoch links are usually epoch blocks, a send to the epoch link account will fall back to ledger verification
+			return ledger.is_epoch_link (link) ? ledger.epoch_signer (link) : block.account_field ().value ();
+		}
+		case nano::block_type::open:
+		{
+			return block.account_field ().value ();
+		}
+		case nano::block_type::send:
+		case nano::block_type::receive:
+		case nano::block_type::change:
+		{
+			// Legacy blocks don't contain the account, it is only known when the previous block is already in the ledger
+			return ledger.any.block_account (transaction, block.previous ());
+		}
+		default:
+			return std::nullopt;
+	}
+}
+
 nano::block_status nano::block_processor::process_one (secure::write_transaction const & transaction_a, context const & context, bool const forced_a)
 {
 	auto block = context.block;
 	auto const hash = block->hash ();
-	nano::block_status result = ledger.process (transaction_a, block);
+	nano::block_status result = [&] () {
+		if (context.rejected)
+		{
+			// A block with the same hash might have been inserted since pre-validation, which takes precedence as in the ledger
+			return ledger.any.block_exists_or_pruned (transaction_a, hash) ? nano::block_status::old : *context.rejected;
+		}
+		return ledger.process (transaction_a, block, context.verified_signer);
+	}();
 
 	stats.inc (nano::stat::type::block_processor_result, to_stat_detail (result));
 	stats.inc (nano::stat::type::block_processor_source, to_stat_detail (context.source));
@@ -482,6 +628,7 @@ nano::error nano::block_processor_config::serialize (nano::tomlconfig & toml) co
 	toml.put ("priority_live", priority_live, "Priority for live network blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_bootstrap", priority_bootstrap, "Priority for bootstrap blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_local", priority_local, "Priority for local RPC blocks. Higher priority gets processed more frequently. \ntype:uint64");
+	toml.put ("prevalidation_threads", prevalidation_threads, "Number of threads checking work and signatures of queued blocks before they are applied to the ledger. \ntype:uint64");
 
 	return toml.get_error ();
 }
@@ -493,6 +640,7 @@ nano::error nano::block_processor_config::deserialize (nano::tomlconfig & toml)
 	toml.get ("priority_live", priority_live);
 	toml.get ("priority_bootstrap", priority_bootstrap);
 	toml.get ("priority_local", priority_local);
+	toml.get ("prevalidation_threads", prevalidation_threads);
 
 	return toml.get_error ();
 }
@@ -2,6 +2,7 @@
 
 #include <nano/lib/logging.hpp>
 #include <nano/lib/thread_pool.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/secure/common.hpp>
@@ -11,6 +12,7 @@
 #include <memory>
 #include <optional>
 #include <thread>
+#include <vector>
 
 namespace nano
 {
@@ -52,11 +54,16 @@ public:
 
 	size_t batch_size{ 256 };
 	size_t max_queued_notifications{ 8 };
+
+	// Number of threads checking work and signatures of queued batches before they are applied to the ledger
+	size_t prevalidation_threads{ std::clamp (nano::hardware_concurrency () / 4, 1u, 4u) };
 };
 
 /**
  * Processing blocks is a potentially long IO operation.
  * This class isolates block insertion from other operations like servicing network operations
+ * Processing is pipelined: a pool of pre-validation threads checks work and signatures and filters out already known blocks outside of the ledger write lock,
+ * while previously validated batches are being applied to the ledger by the writer thread in the order they were taken from the queue
  */
 class block_processor final
 {
@@ -73,6 +80,10 @@ public: // Context
 		nano::block_source source;
 		callback_t callback;
 		std::chrono::steady_clock::time_point arrival{ std::chrono::steady_clock::now () };
+		// Set when the block signature was successfully pre-verified for this signer with `validate_message` before entering the ledger
+		std::optional<nano::public_key> verified_signer;
+		// Set when the block was rejected during pre-validation, the ledger is only consulted to check whether it became old in the meantime
+		std::optional<nano::block_status> rejected;
 
 		std::future<result_t> get_future ();
 
@@ -84,7 +95,7 @@ public: // Context
 	};
 
 public:
-	block_processor (nano::node_config const &, nano::ledger &, nano::unchecked_map &, nano::stats &, nano::logger &);
+	block_processor (nano::node_config const &, nano::ledger &, nano::unchecked_map &, nano::signature_checker &, nano::stats &, nano::logger &);
 	~block_processor ();
 
 	void start ();
@@ -115,14 +126,22 @@ private: // Dependencies
 	nano::network_params const & network_params;
 	nano::ledger & ledger;
 	nano::unchecked_map & unchecked;
+	nano::signature_checker & signature_checker;
 	nano::stats & stats;
 	nano::logger & logger;
 
 private:
 	void run ();
+	void run_prevalidation ();
+	bool prevalidation_ready () const;
+	bool batch_ready () const;
 	// Roll back block in the ledger that conflicts with 'block'
 	void rollback_competitor (secure::write_transaction const &, nano::block const & block);
 	nano::block_status process_one (secure::write_transaction const &, context const &, bool forced = false);
+	// Checks work and signatures and filters out already known blocks outside of the ledger write transaction
+	void prevalidate (std::deque<context> &);
+	// Account expected to have signed the block, if it can be determined without the block being in the ledger
+	std::optional<nano::public_key> expected_signer (secure::transaction const &, nano::block const &) const;
 	processed_batch_t process_batch (nano::unique_lock<nano::mutex> &);
 	std::deque<context> next_batch (size_t max_count);
 	context next ();
@@ -130,11 +149,26 @@ private:
 
 private:
 	nano::fair_queue<context, nano::block_source> queue;
+	class pipeline_batch
+	{
+	public:
+		std::deque<context> blocks;
+		// Set once pre-validation of the batch has finished
+		bool ready{ false };
+	};
+	// Batches in pre-validation or waiting to be applied to the ledger, in the order they were taken from the queue
+	std::deque<pipeline_batch> validated;
+	// Number of blocks taken from the queue that are still in the pre-validation or ledger stage
+	std::size_t pipeline_size{ 0 };
 
 	bool stopped{ false };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::block_processor) };
 	std::thread thread;
+	std::vector<std::thread> prevalidation_threads;
+
+	// Limits how far pre-validation can get ahead of the ledger writer
+	static std::size_t constexpr max_validated_batches = 2;
 
 	nano::thread_pool workers;
 };
@@ -119,17 +119,20 @@ bool nano::bootstrap_server::request (nano::asc_pull_req const & message, std::s
 		return false;
 	}
 
-	bool added = false;
-	{
-		std::lock_guard guard{ mutex };
-		added = queue.push ({ message, channel }, { nano::no_value{}, channel });
-	}
+	bool added = queue.push ({ message, channel }, { nano::no_value{}, channel });
 	if (added)
 	{
 		stats.inc (nano::stat::type::bootstrap_server, nano::stat::detail::request);
 		stats.inc (nano::stat::type::bootstrap_server_request, to_stat_detail (message.type));
 
-		condition.notify_one ();
+		if (sleeping > 0)
+		{
+			{
+				// Ensures a thread that just found the queue empty is already waiting on the condition
+				nano::lock_guard<nano::mutex> guard{ mutex };
+			}
+			condition.notify_one ();
+		}
 	}
 	else
 	{
@@ -192,7 +195,9 @@ void nano::bootstrap_server::run ()
 		}
 		else
 		{
+			++sleeping;
 			condition.wait (lock, [this] () { return stopped || !queue.empty (); });
+			--sleeping;
 		}
 	}
 }
@@ -201,13 +206,13 @@ void nano::bootstrap_server::run_batch (nano::unique_lock<nano::mutex> & lock)
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
 
+	lock.unlock ();
+
+	// The queue is shared with other processing threads, the batch might be smaller than expected or even empty
 	debug_assert (config.batch_size > 0);
 	auto batch = queue.next_batch (config.batch_size);
 
-	lock.unlock ();
-
 	auto transaction = ledger.tx_begin_read ();
 
 	for (auto const & [value, origin] : batch)
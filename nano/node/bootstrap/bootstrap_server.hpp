@@ -2,7 +2,7 @@
 
 #include <nano/lib/locks.hpp>
 #include <nano/lib/observer_set.hpp>
-#include <nano/node/fair_queue.hpp>
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/messages.hpp>
 
@@ -90,9 +90,11 @@ private: // Dependencies
 	nano::stats & stats;
 
 private:
-	nano::fair_queue<request_t, nano::no_value> queue;
+	nano::concurrent_fair_queue<request_t, nano::no_value> queue;
 
 	std::atomic<bool> stopped{ false };
+	// Number of threads waiting for requests, producers only need to synchronize with the mutex when some thread might be sleeping
+	std::atomic<size_t> sleeping{ 0 };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex;
 	std::vector<std::thread> threads;
@@ -0,0 +1,468 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/node/fair_queue.hpp>
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+
+namespace nano
+{
+/**
+ * Variant of `fair_queue` that can be pushed to and consumed from concurrently without external locking.
+ * Each origin gets its own bounded lock-free ring, so producers never contend with each other or with consumers for a mutex.
+ * The origin map is protected by a shared mutex that is only taken exclusively when an origin is added or removed.
+ * Consumers are serialized between themselves to preserve the round robin and priority semantics of `fair_queue`.
+ */
+template <typename Request, typename Source>
+class concurrent_fair_queue final
+{
+public:
+	using origin = typename nano::fair_queue<Request, Source>::origin;
+
+private:
+	/**
+	 * Bounded multi-producer multi-consumer ring buffer, cells carry a sequence number that tells producers and consumers whether a cell is ready for them
+	 */
+	class ring
+	{
+	public:
+		explicit ring (size_t capacity) :
+			cells{ std::make_unique<cell[]> (capacity) },
+			mask{ capacity - 1 }
+		{
+			debug_assert (std::has_single_bit (capacity));
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				cells[i].sequence.store (i, std::memory_order_relaxed);
+			}
+		}
+
+		size_t capacity () const
+		{
+			return mask + 1;
+		}
+
+		bool push (Request & request)
+		{
+			auto position = enqueue_position.load (std::memory_order_relaxed);
+			while (true)
+			{
+				auto & cell = cells[position & mask];
+				auto const sequence = cell.sequence.load (std::memory_order_acquire);
+				auto const difference = static_cast<std::ptrdiff_t> (sequence) - static_cast<std::ptrdiff_t> (position);
+				if (difference == 0)
+				{
+					if (enqueue_position.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+					{
+						cell.request.emplace (std::move (request));
+						cell.sequence.store (position + 1, std::memory_order_release);
+						return true; // Added
+					}
+				}
+				else if (difference < 0)
+				{
+					return false; // Full
+				}
+				else
+				{
+					position = enqueue_position.load (std::memory_order_relaxed);
+				}
+			}
+		}
+
+		std::optional<Request> pop ()
+		{
+			auto position = dequeue_position.load (std::memory_order_relaxed);
+			while (true)
+			{
+				auto & cell = cells[position & mask];
+				auto const sequence = cell.sequence.load (std::memory_order_acquire);
+				auto const difference = static_cast<std::ptrdiff_t> (sequence) - static_cast<std::ptrdiff_t> (position + 1);
+				if (difference == 0)
+				{
+					if (dequeue_position.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+					{
+						std::optional<Request> result{ std::move (cell.request) };
+						cell.request.reset ();
+						cell.sequence.store (position + mask + 1, std::memory_order_release);
+						return result;
+					}
+				}
+				else if (difference < 0)
+				{
+					return std::nullopt; // Empty
+				}
+				else
+				{
+					position = dequeue_position.load (std::memory_order_relaxed);
+				}
+			}
+		}
+
+	private:
+		struct cell
+		{
+			std::atomic<size_t> sequence;
+			std::optional<Request> request;
+		};
+
+		std::unique_ptr<cell[]> cells;
+		size_t const mask;
+
+		alignas (64) std::atomic<size_t> enqueue_position{ 0 };
+		alignas (64) std::atomic<size_t> dequeue_position{ 0 };
+	};
+
+	struct entry
+	{
+		ring requests;
+
+		// Updated by producers after a request is pushed to the ring
+		std::atomic<size_t> count{ 0 };
+		std::atomic<size_t> priority;
+		std::atomic<size_t> max_size;
+
+		entry (size_t max_size_a, size_t priority_a) :
+			requests{ std::bit_ceil (std::max (max_size_a, size_t{ 1 })) },
+			priority{ priority_a },
+			max_size{ std::min (max_size_a, requests.capacity ()) }
+		{
+		}
+
+		bool push (Request & request)
+		{
+			// Concurrent producers can overshoot `max_size` slightly, the ring capacity is the hard limit
+			if (count.load (std::memory_order_relaxed) < max_size.load (std::memory_order_relaxed) && requests.push (request))
+			{
+				count.fetch_add (1);
+				return true; // Added
+			}
+			return false; // Dropped
+		}
+
+		// Can fail even when the count is non zero, if a producer reserved an earlier slot in the ring but did not finish writing it yet
+		std::optional<Request> pop ()
+		{
+			auto request = requests.pop ();
+			if (request)
+			{
+				count.fetch_sub (1);
+			}
+			return request;
+		}
+
+		bool empty () const
+		{
+			return count.load () == 0;
+		}
+
+		size_t size () const
+		{
+			return count.load ();
+		}
+	};
+
+	using queues_t = std::map<origin, std::unique_ptr<entry>>;
+
+public:
+	using origin_type = origin;
+	using value_type = std::pair<Request, origin_type>;
+
+public:
+	size_t size (origin_type source) const
+	{
+		std::shared_lock lock{ queues_mutex };
+		auto it = queues.find (source);
+		return it == queues.end () ? 0 : it->second->size ();
+	}
+
+	size_t max_size (origin_type source) const
+	{
+		std::shared_lock lock{ queues_mutex };
+		auto it = queues.find (source);
+		return it == queues.end () ? 0 : it->second->max_size.load ();
+	}
+
+	size_t priority (origin_type source) const
+	{
+		std::shared_lock lock{ queues_mutex };
+		auto it = queues.find (source);
+		return it == queues.end () ? 0 : it->second->priority.load ();
+	}
+
+	size_t size () const
+	{
+		return total_size.load ();
+	}
+
+	bool empty () const
+	{
+		return size () == 0;
+	}
+
+	size_t queues_size () const
+	{
+		std::shared_lock lock{ queues_mutex };
+		return queues.size ();
+	}
+
+	void clear ()
+	{
+		nano::lock_guard<nano::mutex> consumer_guard{ consumer_mutex };
+		std::unique_lock lock{ queues_mutex };
+		for (auto const & [source, queue] : queues)
+		{
+			total_size -= queue->size ();
+		}
+		queues.clear ();
+		iterator = queues.end ();
+	}
+
+	/**
+	 * Should be called periodically to clean up stale channels and update queue priorities and max sizes
+	 */
+	bool periodic_update (std::chrono::milliseconds interval = std::chrono::milliseconds{ 1000 * 30 })
+	{
+		nano::lock_guard<nano::mutex> consumer_guard{ consumer_mutex };
+		return periodic_update_impl (interval);
+	}
+
+	/**
+	 * Push a request to the appropriate queue based on the source
+	 * Request will be dropped if the queue is full
+	 * @return true if added, false if dropped
+	 */
+	bool push (Request request, origin_type source)
+	{
+		{
+			std::shared_lock lock{ queues_mutex };
+			if (auto it = queues.find (source); it != queues.end ())
+			{
+				return push_impl (*it->second, request);
+			}
+		}
+
+		// Create a new queue if it doesn't exist, another producer might have created it in the meantime
+		std::unique_lock lock{ queues_mutex };
+		auto it = queues.find (source);
+		if (it == queues.end ())
+		{
+			auto max_size = max_size_query (source);
+			auto priority = priority_query (source);
+
+			// Existing iterators stay valid, since std::map container guarantees that iterators are not invalidated by insert operations
+			it = queues.emplace (source, std::make_unique<entry> (max_size, priority)).first;
+		}
+		release_assert (it != queues.end ());
+		return push_impl (*it->second, request);
+	}
+
+public:
+	using max_size_query_t = std::function<size_t (origin_type const &)>;
+	using priority_query_t = std::function<size_t (origin_type const &)>;
+
+	max_size_query_t max_size_query{ [] (auto const & origin) { debug_assert (false, "max_size_query callback empty"); return 0; } };
+	priority_query_t priority_query{ [] (auto const & origin) { debug_assert (false, "priority_query callback empty"); return 0; } };
+
+public:
+	/**
+	 * Must only be used when there is a single consumer, otherwise the queue might be emptied between checking `empty ()` and calling this
+	 */
+	value_type next ()
+	{
+		release_assert (!empty ()); // Should be checked before calling next
+
+		nano::lock_guard<nano::mutex> consumer_guard{ consumer_mutex };
+		std::shared_lock lock{ queues_mutex };
+		while (true)
+		{
+			if (auto result = next_impl ())
+			{
+				return std::move (*result);
+			}
+			// A producer is still writing the request, it will be available momentarily
+			std::this_thread::yield ();
+		}
+	}
+
+	/**
+	 * Can be called by multiple consumers at once, each request is returned to exactly one of them
+	 * @return up to `max_count` requests, might be empty if other consumers took all queued requests
+	 */
+	std::deque<value_type> next_batch (size_t max_count)
+	{
+		nano::lock_guard<nano::mutex> consumer_guard{ consumer_mutex };
+
+		periodic_update_impl ();
+
+		std::shared_lock lock{ queues_mutex };
+
+		auto const count = std::min (size (), max_count);
+
+		std::deque<value_type> result;
+		while (result.size () < count)
+		{
+			auto next = next_impl ();
+			if (!next)
+			{
+				break;
+			}
+			result.emplace_back (std::move (*next));
+		}
+		return result;
+	}
+
+private:
+	bool push_impl (entry & queue, Request & request)
+	{
+		bool added = queue.push (request); // True if added, false if dropped
+		if (added)
+		{
+			++total_size;
+		}
+		return added;
+	}
+
+	// Requires both the consumer mutex and (at least) a shared lock on the queues mutex
+	std::optional<value_type> next_impl ()
+	{
+		if (should_seek () && !seek_next ())
+		{
+			return std::nullopt;
+		}
+
+		release_assert (iterator != queues.end ());
+
+		auto & source = iterator->first;
+		auto & queue = *iterator->second;
+
+		auto request = queue.pop ();
+		if (!request)
+		{
+			return std::nullopt;
+		}
+
+		++counter;
+		--total_size;
+
+		return value_type{ std::move (*request), source };
+	}
+
+	bool should_seek () const
+	{
+		if (iterator == queues.end ())
+		{
+			return true;
+		}
+		auto & queue = *iterator->second;
+		if (queue.empty ())
+		{
+			return true;
+		}
+		// Allow up to `queue.priority` requests to be processed before moving to the next queue
+		if (counter >= queue.priority.load (std::memory_order_relaxed))
+		{
+			return true;
+		}
+		return false;
+	}
+
+	// Unlike `fair_queue`, producers can add requests concurrently, so the scan is limited to a single pass over all queues
+	bool seek_next ()
+	{
+		counter = 0;
+		for (size_t scanned = 0; scanned <= queues.size (); ++scanned)
+		{
+			if (iterator != queues.end ())
+			{
+				++iterator;
+			}
+			if (iterator == queues.end ())
+			{
+				iterator = queues.begin ();
+			}
+			if (iterator == queues.end ())
+			{
+				return false;
+			}
+			if (!iterator->second->empty ())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Requires the consumer mutex
+	bool periodic_update_impl (std::chrono::milliseconds interval = std::chrono::milliseconds{ 1000 * 30 })
+	{
+		if (elapsed (last_update, interval))
+		{
+			last_update = std::chrono::steady_clock::now ();
+
+			std::unique_lock lock{ queues_mutex };
+			cleanup ();
+			update ();
+
+			return true; // Updated
+		}
+		return false; // Not updated
+	}
+
+	void cleanup ()
+	{
+		// Invalidate the current iterator
+		iterator = queues.end ();
+
+		// Only removing empty queues, no need to update the `total size` counter
+		// Producers hold a shared lock while pushing, so no request can be added to a queue while it is being removed
+		erase_if (queues, [] (auto const & entry) {
+			return entry.second->empty () && !entry.first.alive ();
+		});
+	}
+
+	void update ()
+	{
+		for (auto & [source, queue] : queues)
+		{
+			// Rings can't grow, limit the max size to the capacity allocated when the queue was created
+			queue->max_size = std::min (max_size_query (source), queue->requests.capacity ());
+			queue->priority = priority_query (source);
+		}
+	}
+
+private:
+	queues_t queues;
+	mutable std::shared_mutex queues_mutex;
+
+	// Round robin state, only accessed by consumers
+	typename queues_t::iterator iterator{ queues.end () };
+	size_t counter{ 0 };
+	std::chrono::steady_clock::time_point last_update{ std::chrono::steady_clock::now () };
+	nano::mutex consumer_mutex;
+
+	std::atomic<size_t> total_size{ 0 };
+
+public:
+	nano::container_info container_info () const
+	{
+		std::shared_lock lock{ queues_mutex };
+
+		nano::container_info info;
+		info.put ("queues", queues);
+		info.put ("total_size", size ());
+		return info;
+	}
+};
+}
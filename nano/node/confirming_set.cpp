@@ -10,6 +10,8 @@
 #include <nano/store/component.hpp>
 #include <nano/store/write_queue.hpp>
 
+#include <latch>
+
 nano::confirming_set::confirming_set (confirming_set_config const & config_a, nano::ledger & ledger_a, nano::block_processor & block_processor_a, nano::stats & stats_a, nano::logger & logger_a) :
 	config{ config_a },
 	ledger{ ledger_a },
@@ -18,6 +20,11 @@ nano::confirming_set::confirming_set (confirming_set_config const & config_a, na
 	logger{ logger_a },
 	workers{ 1, nano::thread_role::name::confirmation_height_notifications }
 {
+	if (config.plan_threads > 0)
+	{
+		planners = std::make_unique<nano::thread_pool> (config.plan_threads, nano::thread_role::name::confirmation_height_planning);
+	}
+
 	batch_cemented.add ([this] (auto const & cemented) {
 		for (auto const & context : cemented)
 		{
@@ -82,6 +89,10 @@ void nano::confirming_set::start ()
 	}
 
 	workers.start ();
+	if (planners)
+	{
+		planners->start ();
+	}
 
 	thread = std::thread{ [this] () {
 		nano::thread_role::set (nano::thread_role::name::confirmation_height);
@@ -101,6 +112,10 @@ void nano::confirming_set::stop ()
 		thread.join ();
 	}
 	workers.stop ();
+	if (planners)
+	{
+		planners->stop ();
+	}
 }
 
 bool nano::confirming_set::contains (nano::block_hash const & hash) const
@@ -153,6 +168,42 @@ auto nano::confirming_set::next_batch (size_t max_count) -> std::deque<entry>
 	return results;
 }
 
+auto nano::confirming_set::plan (std::deque<entry> const & batch) -> std::vector<plan_t>
+{
+	std::vector<plan_t> plans (batch.size ());
+	if (!planners || batch.empty ())
+	{
+		return plans;
+	}
+
+	// Each task plans a contiguous slice of the batch, blocks planned for earlier entries in the same slice are not repeated
+	// Overlap between slices is possible, already confirmed blocks are skipped when the plans are applied
+	// An earlier plan of a slice might not be applied (e.g. its target was rolled back), so blocks are only confirmed from a plan once their dependencies are confirmed
+	auto const parallelism = std::min<size_t> (config.plan_threads, batch.size ());
+	auto const slice_size = (batch.size () + parallelism - 1) / parallelism;
+	auto const max_blocks = std::max<size_t> (config.max_blocks / parallelism, 1);
+
+	std::atomic<size_t> planned_count{ 0 };
+	std::latch done{ static_cast<std::ptrdiff_t> (parallelism) };
+	for (size_t slice = 0; slice < parallelism; ++slice)
+	{
+		planners->post ([this, &batch, &plans, &planned_count, &done, begin = slice * slice_size, end = std::min ((slice + 1) * slice_size, batch.size ()), max_blocks] () {
+			auto transaction = ledger.tx_begin_read ();
+			std::unordered_set<nano::block_hash> planned;
+			for (auto index = begin; index < end && planned.size () < max_blocks && !stopped; ++index)
+			{
+				plans[index] = ledger.confirm_plan (transaction, batch[index].hash, planned, max_blocks - planned.size ());
+			}
+			planned_count += planned.size ();
+			done.count_down ();
+		});
+	}
+	done.wait ();
+
+	stats.add (nano::stat::type::confirming_set, nano::stat::detail::planned, planned_count);
+	return plans;
+}
+
 void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 {
 	debug_assert (lock.owns_lock ());
@@ -173,6 +224,9 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 
 	lock.unlock ();
 
+	// Work out what needs to be cemented using parallel read transactions, so the write transaction only has to apply the results
+	auto plans = plan (batch);
+
 	auto notify = [this, &cemented] () {
 		std::deque<context> batch;
 		batch.swap (cemented);
@@ -209,10 +263,12 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 
 	{
 		auto transaction = ledger.tx_begin_write (nano::store::writer::confirmation_height);
-		for (auto const & entry : batch)
+		for (size_t index = 0; index < batch.size (); ++index)
 		{
+			auto const & entry = batch[index];
 			auto const & hash = entry.hash;
 			auto const & election = entry.election;
+			auto & plan = plans[index];
 
 			size_t cemented_count = 0;
 			bool success = false;
@@ -238,7 +294,19 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 					break;
 				}
 
-				auto added = ledger.confirm (transaction, hash, config.max_blocks);
+				// A plan is only used for the first attempt, incomplete or outdated plans are finished by regular cementing
+				std::deque<std::shared_ptr<nano::block>> added;
+				if (!plan.empty ())
+				{
+					added = ledger.confirm_planned (transaction, plan);
+					stats.add (nano::stat::type::confirming_set, nano::stat::detail::cemented_planned, added.size ());
+					plan.clear ();
+				}
+				else
+				{
+					added = ledger.confirm (transaction, hash, config.max_blocks);
+				}
+
 				if (!added.empty ())
 				{
 					// Confirming this block may implicitly confirm more
@@ -249,11 +317,10 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 					}
 					cemented_count += added.size ();
 				}
-				else
+				else if (ledger.confirmed.block_exists (transaction, hash))
 				{
 					stats.inc (nano::stat::type::confirming_set, nano::stat::detail::already_cemented);
 					already.push_back (hash);
-					debug_assert (ledger.confirmed.block_exists (transaction, hash));
 				}
 
 				success = ledger.confirmed.block_exists (transaction, hash);
@@ -4,6 +4,7 @@
 #include <nano/lib/numbers_templ.hpp>
 #include <nano/lib/observer_set.hpp>
 #include <nano/lib/thread_pool.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/secure/common.hpp>
 #include <nano/secure/fwd.hpp>
@@ -14,11 +15,13 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <algorithm>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 namespace mi = boost::multi_index;
 
@@ -35,6 +38,8 @@ public:
 
 	/** Maximum number of dependent blocks to be stored in memory during processing */
 	size_t max_blocks{ 128 * 1024 };
+	/** Number of threads computing cementing plans on read transactions ahead of the write transaction, 0 disables planning */
+	unsigned plan_threads{ std::clamp (nano::hardware_concurrency () / 4, 1u, 4u) };
 	size_t max_queued_notifications{ 8 };
 
 	/** Maximum number of failed blocks to wait for requeuing */
@@ -95,9 +100,12 @@ private:
 		std::chrono::steady_clock::time_point timestamp{ std::chrono::steady_clock::now () };
 	};
 
+	using plan_t = std::deque<std::shared_ptr<nano::block>>;
+
 	void run ();
 	void run_batch (std::unique_lock<std::mutex> &);
 	std::deque<entry> next_batch (size_t max_count);
+	std::vector<plan_t> plan (std::deque<entry> const & batch);
 	void cleanup (std::unique_lock<std::mutex> &);
 
 private:
@@ -126,5 +134,6 @@ private:
 	std::thread thread;
 
 	nano::thread_pool workers;
+	std::unique_ptr<nano::thread_pool> planners;
 };
 }
@@ -33,7 +33,10 @@ nano::election::election (nano::node & node_a, std::shared_ptr<nano::block> cons
 	root (block_a->root ()),
 	qualified_root (block_a->qualified_root ())
 {
-	last_votes.emplace (nano::account::null (), nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
+	// Not yet shared, so the tallies can be seeded without taking the mutex
+	nano::vote_info const info{ std::chrono::steady_clock::now (), 0, block_a->hash () };
+	last_votes.emplace (nano::account::null (), info);
+	tally_add (nano::account::null (), info, 0);
 	last_blocks.emplace (block_a->hash (), block_a);
 }
 
@@ -274,8 +277,9 @@ nano::vote_info nano::election::get_last_vote (nano::account const & account)
 
 void nano::election::set_last_vote (nano::account const & account, nano::vote_info vote_info)
 {
+	auto weight = node.ledger.weight (account);
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	last_votes[account] = vote_info;
+	vote_set (account, vote_info, weight);
 }
 
 nano::election_status nano::election::get_status () const
@@ -297,6 +301,7 @@ bool nano::election::transition_time (nano::confirmation_solicitor & solicitor_a
 			}
 			break;
 		case nano::election_state::active:
+			tally_refresh (); // Representative weights might have changed since votes were counted
 			broadcast_vote_locked (lock);
 			broadcast_block (solicitor_a);
 			send_confirm_req (solicitor_a);
@@ -381,40 +386,80 @@ nano::tally_t nano::election::tally () const
 
 nano::tally_t nano::election::tally_impl () const
 {
-	std::unordered_map<nano::block_hash, nano::uint128_t> block_weights;
-	std::unordered_map<nano::block_hash, nano::uint128_t> final_weights_l;
-	for (auto const & [account, info] : last_votes)
-	{
-		auto rep_weight (node.ledger.weight (account));
-		block_weights[info.hash] += rep_weight;
-		if (info.timestamp == std::numeric_limits<uint64_t>::max ())
-		{
-			final_weights_l[info.hash] += rep_weight;
-		}
-	}
-	last_tally = block_weights;
 	nano::tally_t result;
-	for (auto const & [hash, amount] : block_weights)
+	for (auto const & [hash, tally] : block_tallies)
 	{
 		auto block (last_blocks.find (hash));
 		if (block != last_blocks.end ())
 		{
-			result.emplace (amount, block->second);
+			result.emplace (tally.weight, block->second);
 		}
 	}
-	// Calculate final votes sum for winner
-	if (!final_weights_l.empty () && !result.empty ())
+	// Final votes sum for winner
+	if (!result.empty ())
 	{
-		auto winner_hash (result.begin ()->second->hash ());
-		auto find_final (final_weights_l.find (winner_hash));
-		if (find_final != final_weights_l.end ())
+		auto const & winner_tally = block_tallies.at (result.begin ()->second->hash ());
+		if (winner_tally.final_weight > 0)
 		{
-			final_weight = find_final->second;
+			final_weight = winner_tally.final_weight;
 		}
 	}
 	return result;
 }
 
+void nano::election::vote_set (nano::account const & account, nano::vote_info const & info, nano::uint128_t const & weight)
+{
+	debug_assert (!mutex.try_lock ());
+	tally_remove (account);
+	last_votes[account] = info;
+	tally_add (account, info, weight);
+}
+
+void nano::election::vote_erase (nano::account const & account)
+{
+	debug_assert (!mutex.try_lock ());
+	tally_remove (account);
+	last_votes.erase (account);
+}
+
+void nano::election::tally_add (nano::account const & account, nano::vote_info const & info, nano::uint128_t const & weight)
+{
+	bool const final = nano::vote::is_final_timestamp (info.timestamp);
+	auto & tally = block_tallies[info.hash];
+	tally.weight += weight;
+	tally.final_weight += final ? weight : 0;
+	++tally.voters;
+	voter_tallies[account] = { info.hash, weight, final };
+}
+
+void nano::election::tally_remove (nano::account const & account)
+{
+	if (auto existing = voter_tallies.find (account); existing != voter_tallies.end ())
+	{
+		auto const & [hash, weight, final] = existing->second;
+		auto tally = block_tallies.find (hash);
+		release_assert (tally != block_tallies.end ());
+		tally->second.weight -= weight;
+		tally->second.final_weight -= final ? weight : 0;
+		if (--tally->second.voters == 0)
+		{
+			block_tallies.erase (tally);
+		}
+		voter_tallies.erase (existing);
+	}
+}
+
+void nano::election::tally_refresh ()
+{
+	debug_assert (!mutex.try_lock ());
+	block_tallies.clear ();
+	voter_tallies.clear ();
+	for (auto const & [account, info] : last_votes)
+	{
+		tally_add (account, info, node.ledger.weight (account));
+	}
+}
+
 void nano::election::confirm_if_quorum (nano::unique_lock<nano::mutex> & lock_a)
 {
 	debug_assert (lock_a.owns_lock ());
@@ -517,7 +562,7 @@ nano::vote_code nano::election::vote (nano::account const & rep, uint64_t timest
 		}
 	}
 
-	last_votes[rep] = { std::chrono::steady_clock::now (), timestamp_a, block_hash_a };
+	vote_set (rep, { std::chrono::steady_clock::now (), timestamp_a, block_hash_a }, weight);
 	if (vote_source_a != vote_source::cache)
 	{
 		live_vote_action (rep);
@@ -664,7 +709,7 @@ void nano::election::remove_votes (nano::block_hash const & hash_a)
 		auto list_generated_votes (node.history.votes (root, hash_a));
 		for (auto const & vote : list_generated_votes)
 		{
-			last_votes.erase (vote->account);
+			vote_erase (vote->account);
 		}
 		// Clear votes cache
 		node.history.erase (root);
@@ -678,9 +723,18 @@ void nano::election::remove_block (nano::block_hash const & hash_a)
 	{
 		if (auto existing = last_blocks.find (hash_a); existing != last_blocks.end ())
 		{
-			erase_if (last_votes, [hash_a] (auto const & entry) {
-				return entry.second.hash == hash_a;
-			});
+			std::vector<nano::account> voters;
+			for (auto const & [account, info] : last_votes)
+			{
+				if (info.hash == hash_a)
+				{
+					voters.push_back (account);
+				}
+			}
+			for (auto const & account : voters)
+			{
+				vote_erase (account);
+			}
 
 			node.network.filter.clear (existing->second);
 			last_blocks.erase (hash_a);
@@ -695,8 +749,10 @@ bool nano::election::replace_by_weight (nano::unique_lock<nano::mutex> & lock_a,
 	auto winner_hash (status.winner->hash ());
 	// Sort existing blocks tally
 	std::vector<std::pair<nano::block_hash, nano::uint128_t>> sorted;
-	sorted.reserve (last_tally.size ());
-	std::copy (last_tally.begin (), last_tally.end (), std::back_inserter (sorted));
+	sorted.reserve (block_tallies.size ());
+	std::transform (block_tallies.begin (), block_tallies.end (), std::back_inserter (sorted), [] (auto const & entry) {
+		return std::make_pair (entry.first, entry.second.weight);
+	});
 	lock_a.unlock ();
 
 	// Sort in ascending order
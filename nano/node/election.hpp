@@ -164,6 +164,16 @@ private:
 	void broadcast_vote_locked (nano::unique_lock<nano::mutex> & lock);
 	void remove_votes (nano::block_hash const &);
 	void remove_block (nano::block_hash const &);
+	/**
+	 * Vote tallies are updated incrementally as votes are added or removed, representative weights are captured when a vote is counted
+	 * All modifications of `last_votes` must go through these to keep the tallies consistent
+	 */
+	void vote_set (nano::account const &, nano::vote_info const &, nano::uint128_t const & weight);
+	void vote_erase (nano::account const &);
+	void tally_add (nano::account const &, nano::vote_info const &, nano::uint128_t const & weight);
+	void tally_remove (nano::account const &);
+	// Recounts all votes with current representative weights
+	void tally_refresh ();
 	bool replace_by_weight (nano::unique_lock<nano::mutex> & lock_a, nano::block_hash const &);
 	std::chrono::milliseconds time_to_live () const;
 	/**
@@ -180,7 +190,21 @@ private:
 	std::unordered_map<nano::account, nano::vote_info> last_votes;
 	std::atomic<bool> is_quorum{ false };
 	mutable nano::uint128_t final_weight{ 0 };
-	mutable std::unordered_map<nano::block_hash, nano::uint128_t> last_tally;
+
+	struct block_tally
+	{
+		nano::uint128_t weight{ 0 };
+		nano::uint128_t final_weight{ 0 };
+		size_t voters{ 0 };
+	};
+	struct voter_tally
+	{
+		nano::block_hash hash;
+		nano::uint128_t weight;
+		bool final;
+	};
+	std::unordered_map<nano::block_hash, block_tally> block_tallies;
+	std::unordered_map<nano::account, voter_tally> voter_tallies;
 
 	nano::election_behavior behavior_m;
 	std::chrono::steady_clock::time_point const election_start{ std::chrono::steady_clock::now () };
@@ -33,6 +33,7 @@ class recently_cemented_cache;
 class recently_confirmed_cache;
 class rep_crawler;
 class rep_tiers;
+class signature_checker;
 class telemetry;
 class unchecked_map;
 class stats;
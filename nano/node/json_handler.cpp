@@ -20,6 +20,7 @@
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
 #include <nano/secure/transaction.hpp>
+#include <nano/store/delegator.hpp>
 
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -35,6 +36,7 @@ using ipc_json_handler_no_arg_func_map = std::unordered_map<std::string, std::fu
 ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ();
 auto ipc_json_handler_no_arg_funcs = create_ipc_json_handler_no_arg_func_map ();
 bool block_confirmed (nano::node & node, nano::secure::transaction & transaction, nano::block_hash const & hash, bool include_active, bool include_only_confirmed);
+std::vector<bool> blocks_confirmed (nano::node & node, nano::secure::transaction & transaction, std::vector<nano::block_hash> const & hashes, bool include_active, bool include_only_confirmed);
 char const * epoch_as_string (nano::epoch);
 }
 
@@ -166,6 +168,95 @@ void nano::json_handler::response_errors ()
 	}
 }
 
+/** Output and progress of a response produced by `stream_response` */
+class nano::json_handler::stream_state final
+{
+public:
+	explicit stream_state (std::function<bool (nano::json_writer &)> page_a) :
+		page{ std::move (page_a) }
+	{
+	}
+
+	std::function<bool (nano::json_writer &)> page;
+	// Output of the writer that has not been handed to the client yet
+	std::string output;
+	nano::json_writer writer{ [this] (std::string const & data_a) {
+		output.append (data_a);
+		return true;
+	} };
+	bool sent{ false };
+};
+
+void nano::json_handler::stream_response (std::function<void (nano::json_writer &)> const & begin_a, std::function<bool (nano::json_writer &)> page_a)
+{
+	auto state = std::make_shared<stream_state> (std::move (page_a));
+	state->writer.begin_object ();
+	begin_a (state->writer);
+	if (!chunk)
+	{
+		while (!state->page (state->writer))
+		{
+		}
+		state->writer.end ();
+		state->writer.end_object ();
+		state->writer.finish ();
+		response (state->output);
+		return;
+	}
+	node.workers.post (create_worker_task ([state] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+		rpc_l->stream_page (state);
+	}));
+}
+
+void nano::json_handler::stream_page (std::shared_ptr<stream_state> const & state_a)
+{
+	bool done = false;
+	try
+	{
+		done = state_a->page (state_a->writer);
+	}
+	catch (...)
+	{
+		if (!state_a->sent)
+		{
+			throw; // Nothing was sent yet, respond with an error instead
+		}
+		// The client sees a truncated document
+		chunk ("", true, nullptr);
+		return;
+	}
+	if (done)
+	{
+		state_a->writer.end ();
+		state_a->writer.end_object ();
+		state_a->writer.finish ();
+	}
+	std::string output;
+	output.swap (state_a->output);
+	if (done)
+	{
+		chunk (output, true, nullptr);
+		return;
+	}
+	// The next page is only produced once the client has read enough of the queued output, no worker waits for it in the meantime
+	auto next = [rpc_l = shared_from_this (), state_a] (bool ready_a) {
+		if (ready_a)
+		{
+			rpc_l->node.workers.post (rpc_l->create_worker_task ([state_a] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+				rpc_l->stream_page (state_a);
+			}));
+		}
+	};
+	if (output.empty ())
+	{
+		// The writer has not filled a chunk yet
+		next (true);
+		return;
+	}
+	state_a->sent = true;
+	chunk (output, false, next);
+}
+
 std::shared_ptr<nano::wallet> nano::json_handler::wallet_impl ()
 {
 	if (!ec)
@@ -262,6 +353,52 @@ nano::account_info nano::json_handler::account_info_impl (secure::transaction co
 	return result;
 }
 
+auto nano::json_handler::accounts_batch_impl (secure::transaction const & transaction_a) -> std::vector<account_batch_entry>
+{
+	std::vector<account_batch_entry> result;
+	std::vector<nano::account> accounts;
+	for (auto & account_from_request : request.get_child ("accounts"))
+	{
+		auto account = account_impl (account_from_request.second.data ());
+		result.push_back ({ account_from_request.second.data (), account, std::nullopt, ec });
+		accounts.push_back (account);
+		ec = {};
+	}
+	// Looking up all accounts at once lets the store visit them in key order
+	auto infos = node.ledger.any.account_get (transaction_a, accounts);
+	for (size_t i = 0; i < result.size (); ++i)
+	{
+		auto & entry = result[i];
+		if (!entry.error)
+		{
+			entry.info = infos[i];
+			if (!entry.info)
+			{
+				entry.error = nano::error_common::account_not_found;
+			}
+		}
+	}
+	return result;
+}
+
+auto nano::json_handler::hashes_batch_impl () -> hashes_batch
+{
+	hashes_batch result;
+	for (auto & hashes : request.get_child ("hashes"))
+	{
+		std::string hash_text = hashes.second.data ();
+		nano::block_hash hash;
+		if (hash.decode_hex (hash_text))
+		{
+			result.decode_error = true;
+			break;
+		}
+		result.hash_texts.push_back (hash_text);
+		result.hashes.push_back (hash);
+	}
+	return result;
+}
+
 nano::amount nano::json_handler::amount_impl ()
 {
 	nano::amount result (0);
@@ -886,24 +1023,61 @@ void nano::json_handler::accounts_balances ()
 {
 	boost::property_tree::ptree balances;
 	boost::property_tree::ptree errors;
-	auto transaction = node.store.tx_begin_read ();
-	for (auto & account_from_request : request.get_child ("accounts"))
+	bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
+	auto transaction = node.ledger.tx_begin_read ();
+	auto accounts = accounts_batch_impl (transaction);
+	// The account balance is the balance of the head block, the confirmed balance only needs a block lookup when the head is not confirmed yet
+	std::vector<std::optional<nano::amount>> confirmed_balances (accounts.size ());
+	if (include_only_confirmed)
 	{
-		boost::property_tree::ptree entry;
-		auto account = account_impl (account_from_request.second.data ());
-		if (!ec)
+		std::vector<size_t> indices;
+		std::vector<nano::block_hash> frontiers;
+		for (size_t i = 0; i < accounts.size (); ++i)
 		{
-			bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
-			auto balance = node.balance_pending (account, include_only_confirmed);
-			entry.put ("balance", balance.first.convert_to<std::string> ());
-			entry.put ("pending", balance.second.convert_to<std::string> ());
-			entry.put ("receivable", balance.second.convert_to<std::string> ());
-			balances.put_child (account_from_request.second.data (), entry);
+			auto const & [account_text, account, info, error] = accounts[i];
+			if (info)
+			{
+				auto const confirmation_height = node.store.confirmation_height.get (transaction, account);
+				if (confirmation_height && confirmation_height->frontier == info->head)
+				{
+					confirmed_balances[i] = info->balance;
+				}
+				else if (confirmation_height)
+				{
+					indices.push_back (i);
+					frontiers.push_back (confirmation_height->frontier);
+				}
+			}
+		}
+		auto blocks = node.ledger.any.block_get (transaction, frontiers);
+		for (size_t j = 0; j < indices.size (); ++j)
+		{
+			if (blocks[j] != nullptr)
+			{
+				confirmed_balances[indices[j]] = blocks[j]->balance ();
+			}
+		}
+	}
+	for (size_t i = 0; i < accounts.size (); ++i)
+	{
+		auto const & [account_text, account, info, error] = accounts[i];
+		// Accounts that are not opened yet have no balance but might have receivable blocks
+		if (!error || error == nano::error_common::account_not_found)
+		{
+			nano::uint128_t balance = 0;
+			if (info)
+			{
+				balance = include_only_confirmed ? confirmed_balances[i].value_or (0).number () : info->balance.number ();
+			}
+			auto const receivable = node.ledger.account_receivable (transaction, account, include_only_confirmed);
+			boost::property_tree::ptree entry;
+			entry.put ("balance", balance.convert_to<std::string> ());
+			entry.put ("pending", receivable.convert_to<std::string> ());
+			entry.put ("receivable", receivable.convert_to<std::string> ());
+			balances.put_child (account_text, entry);
 			continue;
 		}
-		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
-		ec = {};
+		errors.put (account_text, error.message ());
 	}
 	if (!balances.empty ())
 	{
@@ -921,21 +1095,15 @@ void nano::json_handler::accounts_representatives ()
 	boost::property_tree::ptree representatives;
 	boost::property_tree::ptree errors;
 	auto transaction = node.ledger.tx_begin_read ();
-	for (auto & account_from_request : request.get_child ("accounts"))
+	auto accounts = accounts_batch_impl (transaction);
+	for (auto const & [account_text, account, info, error] : accounts)
 	{
-		auto account = account_impl (account_from_request.second.data ());
-		if (!ec)
+		if (!error)
 		{
-			auto info = account_info_impl (transaction, account);
-			if (!ec)
-			{
-				representatives.put (account_from_request.second.data (), info.representative.to_account ());
-				continue;
-			}
+			representatives.put (account_text, info->representative.to_account ());
+			continue;
 		}
-		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
-		ec = {};
+		errors.put (account_text, error.message ());
 	}
 	if (!representatives.empty ())
 	{
@@ -978,25 +1146,15 @@ void nano::json_handler::accounts_frontiers ()
 	boost::property_tree::ptree frontiers;
 	boost::property_tree::ptree errors;
 	auto transaction = node.ledger.tx_begin_read ();
-	for (auto & account_from_request : request.get_child ("accounts"))
+	auto accounts = accounts_batch_impl (transaction);
+	for (auto const & [account_text, account, info, error] : accounts)
 	{
-		auto account = account_impl (account_from_request.second.data ());
-		if (!ec)
+		if (!error)
 		{
-			auto latest = node.ledger.any.account_head (transaction, account);
-			if (!latest.is_zero ())
-			{
-				frontiers.put (account.to_account (), latest.to_string ());
-				continue;
-			}
-			else
-			{
-				ec = nano::error_common::account_not_found;
-			}
+			frontiers.put (account.to_account (), info->head.to_string ());
+			continue;
 		}
-		debug_assert (ec);
-		errors.put (account_from_request.second.data (), ec.message ());
-		ec = {};
+		errors.put (account_text, error.message ());
 	}
 	if (!frontiers.empty ())
 	{
@@ -1017,6 +1175,8 @@ void nano::json_handler::accounts_pending ()
 
 void nano::json_handler::accounts_receivable ()
 {
+	// Maximum number of receivable entries checked for confirmation with a single block lookup
+	std::size_t constexpr receivable_batch_size = 256;
 	auto count (count_optional_impl ());
 	auto threshold (threshold_optional_impl ());
 	bool const source = request.get<bool> ("source", false);
@@ -1032,33 +1192,44 @@ void nano::json_handler::accounts_receivable ()
 		if (!ec)
 		{
 			boost::property_tree::ptree peers_l;
-			for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end (transaction)); i != n && nano::pending_key (i->first).account == account && peers_l.size () < count; ++i)
-			{
-				nano::pending_key const & key (i->first);
-				if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+			auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0)));
+			auto n (node.store.pending.end (transaction));
+			while (i != n && nano::pending_key (i->first).account == account && peers_l.size () < count)
+			{
+				// Receivable entries come from a range scan, the send blocks needed to check their confirmation are looked up in batches
+				std::vector<std::pair<nano::pending_key, nano::pending_info>> candidates;
+				std::vector<nano::block_hash> hashes;
+				for (; i != n && nano::pending_key (i->first).account == account && candidates.size () < std::min<uint64_t> (count - peers_l.size (), receivable_batch_size); ++i)
 				{
+					candidates.emplace_back (i->first, i->second);
+					hashes.push_back (candidates.back ().first.hash);
+				}
+				auto confirmed = blocks_confirmed (node, transaction, hashes, include_active, include_only_confirmed);
+				for (size_t j = 0; j < candidates.size (); ++j)
+				{
+					auto const & [key, info] = candidates[j];
+					if (!confirmed[j])
+					{
+						continue;
+					}
 					if (simple)
 					{
 						boost::property_tree::ptree entry;
 						entry.put ("", key.hash.to_string ());
 						peers_l.push_back (std::make_pair ("", entry));
 					}
-					else
+					else if (info.amount.number () >= threshold.number ())
 					{
-						nano::pending_info const & info (i->second);
-						if (info.amount.number () >= threshold.number ())
+						if (source)
 						{
-							if (source)
-							{
-								boost::property_tree::ptree pending_tree;
-								pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
-								pending_tree.put ("source", info.source.to_account ());
-								peers_l.add_child (key.hash.to_string (), pending_tree);
-							}
-							else
-							{
-								peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
-							}
+							boost::property_tree::ptree pending_tree;
+							pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
+							pending_tree.put ("source", info.source.to_account ());
+							peers_l.add_child (key.hash.to_string (), pending_tree);
+						}
+						else
+						{
+							peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
 						}
 					}
 				}
@@ -1229,40 +1400,34 @@ void nano::json_handler::blocks ()
 	bool const json_block_l = request.get<bool> ("json_block", false);
 	boost::property_tree::ptree blocks;
 	auto transaction = node.ledger.tx_begin_read ();
-	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
+	auto [hash_texts, hashes, decode_error] = hashes_batch_impl ();
+	auto blocks_l = node.ledger.any.block_get (transaction, hashes);
+	for (size_t i = 0; i < hashes.size () && !ec; ++i)
 	{
-		if (!ec)
+		auto const & block = blocks_l[i];
+		if (block != nullptr)
 		{
-			std::string hash_text = hashes.second.data ();
-			nano::block_hash hash;
-			if (!hash.decode_hex (hash_text))
+			if (json_block_l)
 			{
-				auto block = node.ledger.any.block_get (transaction, hash);
-				if (block != nullptr)
-				{
-					if (json_block_l)
-					{
-						boost::property_tree::ptree block_node_l;
-						block->serialize_json (block_node_l);
-						blocks.add_child (hash_text, block_node_l);
-					}
-					else
-					{
-						std::string contents;
-						block->serialize_json (contents);
-						blocks.put (hash_text, contents);
-					}
-				}
-				else
-				{
-					ec = nano::error_blocks::not_found;
-				}
+				boost::property_tree::ptree block_node_l;
+				block->serialize_json (block_node_l);
+				blocks.add_child (hash_texts[i], block_node_l);
 			}
 			else
 			{
-				ec = nano::error_blocks::bad_hash_number;
+				std::string contents;
+				block->serialize_json (contents);
+				blocks.put (hash_texts[i], contents);
 			}
 		}
+		else
+		{
+			ec = nano::error_blocks::not_found;
+		}
+	}
+	if (!ec && decode_error)
+	{
+		ec = nano::error_blocks::bad_hash_number;
 	}
 	response_l.add_child ("blocks", blocks);
 	response_errors ();
@@ -1280,122 +1445,138 @@ void nano::json_handler::blocks_info ()
 	boost::property_tree::ptree blocks;
 	boost::property_tree::ptree blocks_not_found;
 	auto transaction = node.ledger.tx_begin_read ();
-	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
+	auto [hash_texts, hashes, decode_error] = hashes_batch_impl ();
+	auto blocks_l = node.ledger.any.block_get (transaction, hashes);
+	// Receivable status of all send blocks is looked up in a single batch as well
+	std::vector<std::optional<nano::pending_info>> pending_l (hashes.size ());
+	if (receivable || receive_hash)
 	{
-		if (!ec)
+		std::vector<nano::pending_key> keys;
+		std::vector<size_t> indices;
+		for (size_t i = 0; i < hashes.size (); ++i)
 		{
-			std::string hash_text = hashes.second.data ();
-			nano::block_hash hash;
-			if (!hash.decode_hex (hash_text))
+			if (blocks_l[i] != nullptr && blocks_l[i]->is_send ())
 			{
-				auto block = node.ledger.any.block_get (transaction, hash);
-				if (block != nullptr)
+				keys.emplace_back (blocks_l[i]->destination (), hashes[i]);
+				indices.push_back (i);
+			}
+		}
+		auto results = node.ledger.any.pending_get (transaction, keys);
+		for (size_t i = 0; i < indices.size (); ++i)
+		{
+			pending_l[indices[i]] = results[i];
+		}
+	}
+	for (size_t i = 0; i < hashes.size () && !ec; ++i)
+	{
+		auto const & hash = hashes[i];
+		auto const & hash_text = hash_texts[i];
+		auto const & block = blocks_l[i];
+		if (block != nullptr)
+		{
+			boost::property_tree::ptree entry;
+			auto account = block->account ();
+			entry.put ("block_account", account.to_account ());
+			auto amount = node.ledger.any.block_amount (transaction, hash);
+			if (amount)
+			{
+				entry.put ("amount", amount.value ().number ().convert_to<std::string> ());
+			}
+			auto balance = block->balance ();
+			entry.put ("balance", balance.number ().convert_to<std::string> ());
+			entry.put ("height", std::to_string (block->sideband ().height));
+			entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
+			entry.put ("successor", block->sideband ().successor.to_string ());
+			auto confirmed (node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
+			entry.put ("confirmed", confirmed);
+
+			if (json_block_l)
+			{
+				boost::property_tree::ptree block_node_l;
+				block->serialize_json (block_node_l);
+				entry.add_child ("contents", block_node_l);
+			}
+			else
+			{
+				std::string contents;
+				block->serialize_json (contents);
+				entry.put ("contents", contents);
+			}
+			if (block->type () == nano::block_type::state)
+			{
+				auto subtype (nano::state_subtype (block->sideband ().details));
+				entry.put ("subtype", subtype);
+			}
+			if (receivable || receive_hash)
+			{
+				if (!block->is_send ())
 				{
-					boost::property_tree::ptree entry;
-					auto account = block->account ();
-					entry.put ("block_account", account.to_account ());
-					auto amount = node.ledger.any.block_amount (transaction, hash);
-					if (amount)
+					if (receivable)
 					{
-						entry.put ("amount", amount.value ().number ().convert_to<std::string> ());
+						entry.put ("pending", "0");
+						entry.put ("receivable", "0");
 					}
-					auto balance = block->balance ();
-					entry.put ("balance", balance.number ().convert_to<std::string> ());
-					entry.put ("height", std::to_string (block->sideband ().height));
-					entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
-					entry.put ("successor", block->sideband ().successor.to_string ());
-					auto confirmed (node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
-					entry.put ("confirmed", confirmed);
-
-					if (json_block_l)
+					if (receive_hash)
 					{
-						boost::property_tree::ptree block_node_l;
-						block->serialize_json (block_node_l);
-						entry.add_child ("contents", block_node_l);
+						entry.put ("receive_hash", nano::block_hash (0).to_string ());
 					}
-					else
+				}
+				else if (pending_l[i])
+				{
+					if (receivable)
 					{
-						std::string contents;
-						block->serialize_json (contents);
-						entry.put ("contents", contents);
+						entry.put ("pending", "1");
+						entry.put ("receivable", "1");
 					}
-					if (block->type () == nano::block_type::state)
+					if (receive_hash)
 					{
-						auto subtype (nano::state_subtype (block->sideband ().details));
-						entry.put ("subtype", subtype);
+						entry.put ("receive_hash", nano::block_hash (0).to_string ());
 					}
-					if (receivable || receive_hash)
+				}
+				else
+				{
+					if (receivable)
 					{
-						if (!block->is_send ())
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "0");
-								entry.put ("receivable", "0");
-							}
-							if (receive_hash)
-							{
-								entry.put ("receive_hash", nano::block_hash (0).to_string ());
-							}
-						}
-						else if (node.ledger.any.pending_get (transaction, nano::pending_key{ block->destination (), hash }))
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "1");
-								entry.put ("receivable", "1");
-							}
-							if (receive_hash)
-							{
-								entry.put ("receive_hash", nano::block_hash (0).to_string ());
-							}
-						}
-						else
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "0");
-								entry.put ("receivable", "0");
-							}
-							if (receive_hash)
-							{
-								std::shared_ptr<nano::block> receive_block = node.ledger.find_receive_block_by_send_hash (transaction, block->destination (), hash);
-								std::string receive_hash = receive_block ? receive_block->hash ().to_string () : nano::block_hash (0).to_string ();
-								entry.put ("receive_hash", receive_hash);
-							}
-						}
+						entry.put ("pending", "0");
+						entry.put ("receivable", "0");
 					}
-					if (source)
+					if (receive_hash)
 					{
-						if (!block->is_receive () || !node.ledger.any.block_exists (transaction, block->source ()))
-						{
-							entry.put ("source_account", "0");
-						}
-						else
-						{
-							auto block_a = node.ledger.any.block_get (transaction, block->source ());
-							release_assert (block_a);
-							entry.put ("source_account", block_a->account ().to_account ());
-						}
+						std::shared_ptr<nano::block> receive_block = node.ledger.find_receive_block_by_send_hash (transaction, block->destination (), hash);
+						std::string receive_hash = receive_block ? receive_block->hash ().to_string () : nano::block_hash (0).to_string ();
+						entry.put ("receive_hash", receive_hash);
 					}
-					blocks.push_back (std::make_pair (hash_text, entry));
 				}
-				else if (include_not_found)
+			}
+			if (source)
+			{
+				if (!block->is_receive () || !node.ledger.any.block_exists (transaction, block->source ()))
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("", hash_text);
-					blocks_not_found.push_back (std::make_pair ("", entry));
+					entry.put ("source_account", "0");
 				}
 				else
 				{
-					ec = nano::error_blocks::not_found;
+					auto block_a = node.ledger.any.block_get (transaction, block->source ());
+					release_assert (block_a);
+					entry.put ("source_account", block_a->account ().to_account ());
 				}
 			}
-			else
-			{
-				ec = nano::error_blocks::bad_hash_number;
-			}
+			blocks.push_back (std::make_pair (hash_text, entry));
 		}
+		else if (include_not_found)
+		{
+			boost::property_tree::ptree entry;
+			entry.put ("", hash_text);
+			blocks_not_found.push_back (std::make_pair ("", entry));
+		}
+		else
+		{
+			ec = nano::error_blocks::not_found;
+		}
+	}
+	if (!ec && decode_error)
+	{
+		ec = nano::error_blocks::bad_hash_number;
 	}
 	if (!ec)
 	{
@@ -1855,31 +2036,31 @@ void nano::json_handler::chain (bool successors)
 	auto offset (offset_optional_impl (0));
 	if (!ec)
 	{
-		boost::property_tree::ptree blocks;
-		auto transaction = node.ledger.tx_begin_read ();
-		while (!hash.is_zero () && blocks.size () < count)
-		{
-			auto block_l = node.ledger.any.block_get (transaction, hash);
-			if (block_l != nullptr)
+		stream_response ([] (nano::json_writer & writer) { writer.begin_array ("blocks"); },
+		[this, successors, current = hash, skip = offset, remaining = count] (nano::json_writer & writer) mutable {
+			auto transaction = node.ledger.tx_begin_read ();
+			for (std::size_t visited = 0; !current.is_zero () && remaining > 0 && visited < stream_page_size; ++visited)
 			{
-				if (offset > 0)
+				auto block_l = node.ledger.any.block_get (transaction, current);
+				if (block_l == nullptr)
 				{
-					--offset;
+					current.clear ();
+					break;
+				}
+				if (skip > 0)
+				{
+					--skip;
 				}
 				else
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("", hash.to_string ());
-					blocks.push_back (std::make_pair ("", entry));
+					writer.value (current.to_string ());
+					--remaining;
 				}
-				hash = successors ? node.ledger.any.block_successor (transaction, hash).value_or (0) : block_l->previous ();
-			}
-			else
-			{
-				hash.clear ();
+				current = successors ? node.ledger.any.block_successor (transaction, current).value_or (0) : block_l->previous ();
 			}
-		}
-		response_l.add_child ("blocks", blocks);
+			return current.is_zero () || remaining == 0;
+		});
+		return;
 	}
 	response_errors ();
 }
@@ -2172,23 +2353,33 @@ void nano::json_handler::delegators ()
 
 	if (!ec)
 	{
-		auto transaction (node.ledger.tx_begin_read ());
-		boost::property_tree::ptree delegators;
-		for (auto i (node.store.account.begin (transaction, inc_sat (start_account.number ()))), n (node.store.account.end (transaction)); i != n && delegators.size () < count; ++i)
-		{
-			nano::account_info const & info (i->second);
-			if (info.representative == representative)
-			{
-				if (info.balance.number () >= threshold.number ())
+		stream_response ([] (nano::json_writer & writer) { writer.begin_object ("delegators"); },
+		[this, representative, remaining = count, threshold, current = nano::account{ inc_sat (start_account.number ()) }] (nano::json_writer & writer) mutable {
+			auto transaction (node.ledger.tx_begin_read ());
+			// Delegators are indexed by representative, iterate only over entries of the requested representative
+			auto i (node.store.delegator.begin (transaction, representative, current));
+			auto n (node.store.delegator.end (transaction));
+			for (std::size_t visited = 0; i != n && i->first.uint256s[0] == representative && remaining > 0 && visited < stream_page_size; ++i, ++visited)
+			{
+				nano::account const delegator (i->first.uint256s[1]);
+				auto info (node.ledger.any.account_get (transaction, delegator));
+				debug_assert (info && info->representative == representative);
+				if (info && info->balance.number () >= threshold.number ())
 				{
 					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					nano::account const & delegator (i->first);
-					delegators.put (delegator.to_account (), balance);
+					nano::uint128_union (info->balance).encode_dec (balance);
+					writer.value (delegator.to_account (), balance);
+					--remaining;
 				}
 			}
-		}
-		response_l.add_child ("delegators", delegators);
+			if (i == n || i->first.uint256s[0] != representative || remaining == 0)
+			{
+				return true;
+			}
+			current = nano::account{ i->first.uint256s[1] };
+			return false;
+		});
+		return;
 	}
 	response_errors ();
 }
@@ -2200,13 +2391,9 @@ void nano::json_handler::delegators_count ()
 	{
 		uint64_t count (0);
 		auto transaction (node.ledger.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction)), n (node.store.account.end (transaction)); i != n; ++i)
+		for (auto i (node.store.delegator.begin (transaction, account)), n (node.store.delegator.end (transaction)); i != n && i->first.uint256s[0] == account; ++i)
 		{
-			nano::account_info const & info (i->second);
-			if (info.representative == account)
-			{
-				++count;
-			}
+			++count;
 		}
 		response_l.put ("count", std::to_string (count));
 	}
@@ -2309,13 +2496,23 @@ void nano::json_handler::frontiers ()
 	auto count (count_impl ());
 	if (!ec)
 	{
-		boost::property_tree::ptree frontiers;
-		auto transaction (node.ledger.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end (transaction)); i != n && frontiers.size () < count; ++i)
-		{
-			frontiers.put (i->first.to_account (), i->second.head.to_string ());
-		}
-		response_l.add_child ("frontiers", frontiers);
+		stream_response ([] (nano::json_writer & writer) { writer.begin_object ("frontiers"); },
+		[this, current = start, remaining = count] (nano::json_writer & writer) mutable {
+			auto transaction (node.ledger.tx_begin_read ());
+			auto i (node.store.account.begin (transaction, current));
+			auto n (node.store.account.end (transaction));
+			for (std::size_t visited = 0; i != n && remaining > 0 && visited < stream_page_size; ++i, ++visited, --remaining)
+			{
+				writer.value (i->first.to_account (), i->second.head.to_string ());
+			}
+			if (i == n || remaining == 0)
+			{
+				return true;
+			}
+			current = i->first;
+			return false;
+		});
+		return;
 	}
 	response_errors ();
 }
@@ -2710,102 +2907,104 @@ void nano::json_handler::ledger ()
 		bool const weight = request.get<bool> ("weight", false);
 		bool const pending = request.get<bool> ("pending", false);
 		bool const receivable = request.get<bool> ("receivable", pending);
-		boost::property_tree::ptree accounts;
-		auto transaction = node.ledger.tx_begin_read ();
-		if (!ec && !sorting) // Simple
+		if (!ec)
 		{
-			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end (transaction)); i != n && accounts.size () < count; ++i)
-			{
-				nano::account_info const & info (i->second);
-				if (info.modified >= modified_since && (receivable || info.balance.number () >= threshold.number ()))
-				{
-					nano::account const & account (i->first);
-					boost::property_tree::ptree response_a;
+			stream_response ([] (nano::json_writer & writer) { writer.begin_object ("accounts"); },
+			[this, remaining = count, threshold, current = start, modified_since, sorting, sorted = std::optional<std::vector<std::pair<nano::uint128_union, nano::account>>>{}, sorted_index = std::size_t{ 0 }, representative, weight, receivable] (nano::json_writer & writer) mutable {
+				auto transaction = node.ledger.tx_begin_read ();
+				// Returns false if the account was filtered out
+				auto write_account = [&] (nano::account const & account, nano::account_info const & info) {
+					if (!receivable && info.balance.number () < threshold.number ())
+					{
+						return false;
+					}
+					nano::uint128_t account_receivable{ 0 };
 					if (receivable)
 					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
+						account_receivable = node.ledger.account_receivable (transaction, account);
 						if (info.balance.number () + account_receivable < threshold.number ())
 						{
-							continue;
+							return false;
 						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
 					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
+					writer.begin_object (account.to_account ());
+					if (receivable)
+					{
+						writer.value ("pending", account_receivable.convert_to<std::string> ());
+						writer.value ("receivable", account_receivable.convert_to<std::string> ());
+					}
+					writer.value ("frontier", info.head.to_string ());
+					writer.value ("open_block", info.open_block.to_string ());
+					writer.value ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
 					std::string balance;
 					nano::uint128_union (info.balance).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
+					writer.value ("balance", balance);
+					writer.value ("modified_timestamp", std::to_string (info.modified));
+					writer.value ("block_count", std::to_string (info.block_count));
 					if (representative)
 					{
-						response_a.put ("representative", info.representative.to_account ());
+						writer.value ("representative", info.representative.to_account ());
 					}
 					if (weight)
 					{
 						auto account_weight (node.ledger.weight_exact (transaction, account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
+						writer.value ("weight", account_weight.convert_to<std::string> ());
 					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
-				}
-			}
-		}
-		else if (!ec) // Sorting
-		{
-			std::vector<std::pair<nano::uint128_union, nano::account>> ledger_l;
-			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end (transaction)); i != n; ++i)
-			{
-				nano::account_info const & info (i->second);
-				nano::uint128_union balance (info.balance);
-				if (info.modified >= modified_since)
-				{
-					ledger_l.emplace_back (balance, i->first);
-				}
-			}
-			std::sort (ledger_l.begin (), ledger_l.end ());
-			std::reverse (ledger_l.begin (), ledger_l.end ());
-			nano::account_info info;
-			for (auto i (ledger_l.begin ()), n (ledger_l.end ()); i != n && accounts.size () < count; ++i)
-			{
-				node.store.account.get (transaction, i->second, info);
-				if (receivable || info.balance.number () >= threshold.number ())
+					writer.end_object ();
+					return true;
+				};
+				if (!sorting) // Simple
 				{
-					nano::account const & account (i->second);
-					boost::property_tree::ptree response_a;
-					if (receivable)
+					auto i (node.store.account.begin (transaction, current));
+					auto n (node.store.account.end (transaction));
+					for (std::size_t visited = 0; i != n && remaining > 0 && visited < stream_page_size; ++i, ++visited)
 					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
-						if (info.balance.number () + account_receivable < threshold.number ())
+						nano::account_info const & info (i->second);
+						if (info.modified >= modified_since && write_account (i->first, info))
 						{
-							continue;
+							--remaining;
 						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
 					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					(i->first).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
+					if (i == n || remaining == 0)
 					{
-						response_a.put ("representative", info.representative.to_account ());
+						return true;
 					}
-					if (weight)
+					current = i->first;
+					return false;
+				}
+				else // Sorting
+				{
+					// Sorting needs every matching account up front, they are collected by the first page and only the output is paged
+					if (!sorted)
 					{
-						auto account_weight (node.ledger.weight_exact (transaction, account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
+						sorted.emplace ();
+						for (auto i (node.store.account.begin (transaction, current)), n (node.store.account.end (transaction)); i != n; ++i)
+						{
+							nano::account_info const & info (i->second);
+							nano::uint128_union balance (info.balance);
+							if (info.modified >= modified_since)
+							{
+								sorted->emplace_back (balance, i->first);
+							}
+						}
+						std::sort (sorted->begin (), sorted->end ());
+						std::reverse (sorted->begin (), sorted->end ());
+						return sorted->empty ();
 					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
+					for (std::size_t visited = 0; sorted_index < sorted->size () && remaining > 0 && visited < stream_page_size; ++sorted_index, ++visited)
+					{
+						auto const & account = (*sorted)[sorted_index].second;
+						// Accounts are not removed from the ledger, but one may be missing after a rollback since the first page
+						if (auto info = node.ledger.any.account_get (transaction, account); info && write_account (account, *info))
+						{
+							--remaining;
+						}
+					}
+					return sorted_index == sorted->size () || remaining == 0;
 				}
-			}
+			});
+			return;
 		}
-		response_l.add_child ("accounts", accounts);
 	}
 	response_errors ();
 }
@@ -4172,50 +4371,59 @@ void nano::json_handler::unopened ()
 	}
 	if (!ec)
 	{
-		auto transaction = node.store.tx_begin_read ();
-		auto iterator = node.store.pending.begin (transaction, nano::pending_key (start, 0));
-		auto end = node.store.pending.end (transaction);
-		nano::account current_account = start;
-		nano::uint128_t current_account_sum{ 0 };
-		boost::property_tree::ptree accounts;
-		while (iterator != end && accounts.size () < count)
-		{
-			nano::pending_key key{ iterator->first };
-			nano::account account{ key.account };
-			nano::pending_info info{ iterator->second };
-			if (node.store.account.exists (transaction, account))
-			{
-				if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
+		stream_response ([] (nano::json_writer & writer) { writer.begin_object ("accounts"); },
+		[this, remaining = count, threshold, position = nano::pending_key (start, 0), current_account = start, current_account_sum = nano::uint128_t{ 0 }] (nano::json_writer & writer) mutable {
+			auto transaction = node.store.tx_begin_read ();
+			auto iterator = node.store.pending.begin (transaction, position);
+			auto end = node.store.pending.end (transaction);
+			bool exhausted = false;
+			for (std::size_t visited = 0; iterator != end && remaining > 0 && visited < stream_page_size; ++visited)
+			{
+				nano::pending_key key{ iterator->first };
+				nano::account account{ key.account };
+				nano::pending_info info{ iterator->second };
+				if (node.store.account.exists (transaction, account))
 				{
-					break;
+					if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
+					{
+						exhausted = true;
+						break;
+					}
+					// Skip existing accounts
+					iterator = node.store.pending.begin (transaction, nano::pending_key (inc_sat (account.number ()), 0));
 				}
-				// Skip existing accounts
-				iterator = node.store.pending.begin (transaction, nano::pending_key (inc_sat (account.number ()), 0));
-			}
-			else
-			{
-				if (account != current_account)
+				else
 				{
-					if (current_account_sum > 0)
+					if (account != current_account)
 					{
-						if (current_account_sum >= threshold.number ())
+						if (current_account_sum > 0)
 						{
-							accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+							if (current_account_sum >= threshold.number ())
+							{
+								writer.value (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+								--remaining;
+							}
+							current_account_sum = 0;
 						}
-						current_account_sum = 0;
+						current_account = account;
 					}
-					current_account = account;
+					current_account_sum += info.amount.number ();
+					++iterator;
 				}
-				current_account_sum += info.amount.number ();
-				++iterator;
 			}
-		}
-		// last one after iterator reaches end
-		if (accounts.size () < count && current_account_sum > 0 && current_account_sum >= threshold.number ())
-		{
-			accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
-		}
-		response_l.add_child ("accounts", accounts);
+			if (!exhausted && iterator != end && remaining > 0)
+			{
+				position = iterator->first;
+				return false;
+			}
+			// last one after iterator reaches end
+			if (remaining > 0 && current_account_sum > 0 && current_account_sum >= threshold.number ())
+			{
+				writer.value (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+			}
+			return true;
+		});
+		return;
 	}
 	response_errors ();
 }
@@ -5204,6 +5412,20 @@ void nano::inprocess_rpc_handler::process_request (std::string const &, std::str
 	handler->process_request ();
 }
 
+void nano::inprocess_rpc_handler::process_request_chunked (std::string const &, std::string const & body_a, nano::rpc_handler_interface::chunk_t chunk_a)
+{
+	auto handler (std::make_shared<nano::json_handler> (
+	node, node_rpc_config, body_a, [chunk_a] (std::string const & response_a) {
+		chunk_a (response_a, true, nullptr);
+	},
+	[this] () {
+		this->stop_callback ();
+		this->stop ();
+	}));
+	handler->chunk = chunk_a;
+	handler->process_request ();
+}
+
 void nano::inprocess_rpc_handler::process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body_a, std::function<void (std::shared_ptr<std::string> const &)> response_a)
 {
 	std::string body_l = params_a.json_envelope (body_a);
@@ -5386,6 +5608,46 @@ bool block_confirmed (nano::node & node, nano::secure::transaction & transaction
 	return is_confirmed;
 }
 
+// Same as block_confirmed for several blocks, which are looked up at once
+std::vector<bool> blocks_confirmed (nano::node & node, nano::secure::transaction & transaction, std::vector<nano::block_hash> const & hashes, bool include_active, bool include_only_confirmed)
+{
+	std::vector<bool> result (hashes.size (), false);
+	if (include_active && !include_only_confirmed)
+	{
+		result.assign (hashes.size (), true);
+		return result;
+	}
+	auto blocks = node.ledger.any.block_get (transaction, hashes);
+	std::unordered_map<nano::account, uint64_t> confirmed_heights;
+	for (size_t i = 0; i < hashes.size (); ++i)
+	{
+		auto const & block = blocks[i];
+		if (block == nullptr)
+		{
+			// Pruned blocks are confirmed
+			result[i] = !hashes[i].is_zero () && node.store.pruned.exists (transaction, hashes[i]);
+			continue;
+		}
+		auto const account = block->account ();
+		auto existing = confirmed_heights.find (account);
+		if (existing == confirmed_heights.end ())
+		{
+			auto const info = node.store.confirmation_height.get (transaction, account);
+			existing = confirmed_heights.emplace (account, info ? info->height : 0).first;
+		}
+		if (block->sideband ().height <= existing->second)
+		{
+			result[i] = true;
+		}
+		// This just checks it's not currently undergoing an active transaction
+		else if (!include_only_confirmed)
+		{
+			result[i] = !node.active.active (*block);
+		}
+	}
+	return result;
+}
+
 char const * epoch_as_string (nano::epoch epoch)
 {
 	switch (epoch)
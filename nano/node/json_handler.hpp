@@ -1,13 +1,16 @@
 #pragma once
 
+#include <nano/lib/json_writer.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/node/ipc/flatbuffers_handler.hpp>
 #include <nano/node/wallet.hpp>
 #include <nano/rpc/rpc.hpp>
+#include <nano/secure/account_info.hpp>
 
 #include <boost/property_tree/ptree.hpp>
 
 #include <functional>
+#include <optional>
 #include <string>
 
 namespace nano::secure
@@ -153,7 +156,19 @@ public:
 	nano::node & node;
 	boost::property_tree::ptree request;
 	std::function<void (std::string const &)> response;
+	// Set when the response may be delivered in chunks, see `rpc_handler_interface::process_request_chunked`
+	nano::rpc_handler_interface::chunk_t chunk;
 	void response_errors ();
+	/**
+	 * Writes a response with a single object or array that is too large to be built as a property tree, `begin` opens it and `page` writes its entries.
+	 * Every call to `page` continues where the previous one stopped, holding its own read transaction for at most `stream_page_size` entries, and returns true once all entries are written.
+	 * When chunks are supported, each page runs as a separate worker task that is only posted once the client has read enough of the previous output.
+	 */
+	void stream_response (std::function<void (nano::json_writer &)> const & begin, std::function<bool (nano::json_writer &)> page);
+	class stream_state;
+	void stream_page (std::shared_ptr<stream_state> const &);
+	/** Entries examined by one page of a streamed response, which bounds how long its read transaction is held */
+	static std::size_t constexpr stream_page_size = 1024;
 	std::error_code ec;
 	std::string action;
 	boost::property_tree::ptree response_l;
@@ -162,6 +177,23 @@ public:
 	bool wallet_account_impl (store::transaction const &, std::shared_ptr<nano::wallet> const &, nano::account const &);
 	nano::account account_impl (std::string = "", std::error_code = nano::error_common::bad_account_number);
 	nano::account_info account_info_impl (secure::transaction const &, nano::account const &);
+	struct account_batch_entry
+	{
+		std::string account_text;
+		nano::account account;
+		std::optional<nano::account_info> info;
+		std::error_code error;
+	};
+	/** Decodes the "accounts" request field and looks up all accounts in a single batch, preserving the request order */
+	std::vector<account_batch_entry> accounts_batch_impl (secure::transaction const &);
+	struct hashes_batch
+	{
+		std::vector<std::string> hash_texts;
+		std::vector<nano::block_hash> hashes;
+		bool decode_error{ false };
+	};
+	/** Decodes the "hashes" request field, stopping at the first invalid hash */
+	hashes_batch hashes_batch_impl ();
 	nano::amount amount_impl ();
 	std::shared_ptr<nano::block> block_impl (bool = true);
 	nano::block_hash hash_impl (std::string = "hash");
@@ -193,6 +225,7 @@ public:
 	}
 
 	void process_request (std::string const &, std::string const & body_a, std::function<void (std::string const &)> response_a) override;
+	void process_request_chunked (std::string const &, std::string const & body_a, nano::rpc_handler_interface::chunk_t chunk_a) override;
 	void process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body_a, std::function<void (std::shared_ptr<std::string> const &)> response_a) override;
 
 	void stop () override
@@ -249,10 +249,29 @@ void nano::network::send_keepalive_self (std::shared_ptr<nano::transport::channe
 
 void nano::network::flood_message (nano::message const & message, nano::transport::traffic_type type, float scale) const
 {
-	for (auto const & channel : list (fanout (scale)))
+	flood_serialized (message, list (fanout (scale)), type);
+}
+
+void nano::network::flood_serialized (nano::message const & message, std::deque<std::shared_ptr<nano::transport::channel>> const & channels, nano::transport::traffic_type type) const
+{
+	if (channels.empty ())
 	{
-		channel->send (message, type);
+		return;
 	}
+
+	auto const buffer = message.to_shared_const_buffer ();
+	node.stats.inc (nano::stat::type::network, nano::stat::detail::flood, nano::stat::dir::out);
+	node.stats.add (nano::stat::type::network, nano::stat::detail::flood_bytes_serialized, nano::stat::dir::out, buffer.size ());
+
+	std::size_t sent = 0;
+	for (auto const & channel : channels)
+	{
+		if (channel->send (buffer, message.type (), type))
+		{
+			++sent;
+		}
+	}
+	node.stats.add (nano::stat::type::network, nano::stat::detail::flood_bytes_sent, nano::stat::dir::out, buffer.size () * sent);
 }
 
 void nano::network::flood_keepalive (float scale) const
@@ -278,41 +297,39 @@ void nano::network::flood_block (std::shared_ptr<nano::block> const & block, nan
 void nano::network::flood_block_initial (std::shared_ptr<nano::block> const & block) const
 {
 	nano::publish message{ node.network_params.network, block, /* is_originator */ true };
+	std::deque<std::shared_ptr<nano::transport::channel>> channels;
 	for (auto const & rep : node.rep_crawler.principal_representatives ())
 	{
-		rep.channel->send (message, nano::transport::traffic_type::block_broadcast_initial);
+		channels.push_back (rep.channel);
 	}
 	for (auto & peer : list_non_pr (fanout (1.0)))
 	{
-		peer->send (message, nano::transport::traffic_type::block_broadcast_initial);
+		channels.push_back (peer);
 	}
+	flood_serialized (message, channels, nano::transport::traffic_type::block_broadcast_initial);
 }
 
 void nano::network::flood_vote (std::shared_ptr<nano::vote> const & vote, float scale, bool rebroadcasted) const
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
-	for (auto & channel : list (fanout (scale)))
-	{
-		channel->send (message, rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
-	}
+	flood_serialized (message, list (fanout (scale)), rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
 }
 
 void nano::network::flood_vote_non_pr (std::shared_ptr<nano::vote> const & vote, float scale, bool rebroadcasted) const
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
-	for (auto & channel : list_non_pr (fanout (scale)))
-	{
-		channel->send (message, rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
-	}
+	flood_serialized (message, list_non_pr (fanout (scale)), rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
 }
 
 void nano::network::flood_vote_pr (std::shared_ptr<nano::vote> const & vote, bool rebroadcasted) const
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
-	for (auto const & channel : node.rep_crawler.principal_representatives ())
+	std::deque<std::shared_ptr<nano::transport::channel>> channels;
+	for (auto const & rep : node.rep_crawler.principal_representatives ())
 	{
-		channel.channel->send (message, rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
+		channels.push_back (rep.channel);
 	}
+	flood_serialized (message, channels, rebroadcasted ? nano::transport::traffic_type::vote_rebroadcast : nano::transport::traffic_type::vote);
 }
 
 void nano::network::flood_block_many (std::deque<std::shared_ptr<nano::block>> blocks, nano::transport::traffic_type type, std::chrono::milliseconds delay, std::function<void ()> callback) const
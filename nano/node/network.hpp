@@ -153,6 +153,8 @@ private:
 	void run_keepalive ();
 	void run_reachout ();
 	void run_reachout_cached ();
+	// Serializes the message once and shares the resulting buffer between all channels
+	void flood_serialized (nano::message const &, std::deque<std::shared_ptr<nano::transport::channel>> const &, nano::transport::traffic_type) const;
 
 private: // Dependencies
 	network_config const & config;
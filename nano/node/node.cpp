@@ -35,6 +35,7 @@
 #include <nano/node/scheduler/manual.hpp>
 #include <nano/node/scheduler/optimistic.hpp>
 #include <nano/node/scheduler/priority.hpp>
+#include <nano/node/signature_checker.hpp>
 #include <nano/node/telemetry.hpp>
 #include <nano/node/transport/tcp_listener.hpp>
 #include <nano/node/vote_generator.hpp>
@@ -107,13 +108,13 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	distributed_work{ *distributed_work_impl },
 	store_impl{ nano::make_store (logger, application_path_a, network_params.ledger, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade) },
 	store{ *store_impl },
-	unchecked_impl{ std::make_unique<nano::unchecked_map> (config.max_unchecked_blocks, stats, flags.disable_block_processor_unchecked_deletion) },
+	unchecked_impl{ std::make_unique<nano::unchecked_map> (config.max_unchecked_blocks, flags.read_only ? 0 : config.max_unchecked_disk_blocks, application_path_a / "unchecked.ldb", stats, logger, flags.disable_block_processor_unchecked_deletion) },
 	unchecked{ *unchecked_impl },
 	wallets_store_impl{ std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config) },
 	wallets_store{ *wallets_store_impl },
 	wallets_impl{ std::make_unique<nano::wallets> (wallets_store.init_error (), *this) },
 	wallets{ *wallets_impl },
-	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number ()) },
+	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number (), config_a.block_cache) },
 	ledger{ *ledger_impl },
 	outbound_limiter_impl{ std::make_unique<nano::bandwidth_limiter> (config) },
 	outbound_limiter{ *outbound_limiter_impl },
@@ -137,7 +138,9 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	tcp_listener{ *tcp_listener_impl },
 	port_mapping_impl{ std::make_unique<nano::port_mapping> (*this) },
 	port_mapping{ *port_mapping_impl },
-	block_processor_impl{ std::make_unique<nano::block_processor> (config, ledger, unchecked, stats, logger) },
+	signature_checker_impl{ std::make_unique<nano::signature_checker> (config.signature_checker_threads, flags.block_processor_verification_size, stats) },
+	signature_checker{ *signature_checker_impl },
+	block_processor_impl{ std::make_unique<nano::block_processor> (config, ledger, unchecked, signature_checker, stats, logger) },
 	block_processor{ *block_processor_impl },
 	confirming_set_impl{ std::make_unique<nano::confirming_set> (config.confirming_set, ledger, block_processor, stats, logger) },
 	confirming_set{ *confirming_set_impl },
@@ -161,7 +164,7 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	vote_cache{ *vote_cache_impl },
 	vote_router_impl{ std::make_unique<nano::vote_router> (vote_cache, active.recently_confirmed) },
 	vote_router{ *vote_router_impl },
-	vote_processor_impl{ std::make_unique<nano::vote_processor> (config.vote_processor, vote_router, observers, stats, flags, logger, online_reps, rep_crawler, ledger, network_params, rep_tiers) },
+	vote_processor_impl{ std::make_unique<nano::vote_processor> (config.vote_processor, vote_router, signature_checker, observers, stats, flags, logger, online_reps, rep_crawler, ledger, network_params, rep_tiers) },
 	vote_processor{ *vote_processor_impl },
 	vote_cache_processor_impl{ std::make_unique<nano::vote_cache_processor> (config.vote_processor, vote_router, vote_cache, stats, logger) },
 	vote_cache_processor{ *vote_cache_processor_impl },
@@ -181,7 +184,7 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	bootstrap_server{ *bootstrap_server_impl },
 	bootstrap_impl{ std::make_unique<nano::bootstrap_service> (config, block_processor, ledger, network, stats, logger) },
 	bootstrap{ *bootstrap_impl },
-	websocket_impl{ std::make_unique<nano::websocket_server> (config.websocket_config, observers, wallets, ledger, io_ctx, logger) },
+	websocket_impl{ std::make_unique<nano::websocket_server> (config.websocket_config, observers, wallets, ledger, stats, io_ctx, logger) },
 	websocket{ *websocket_impl },
 	epoch_upgrader_impl{ std::make_unique<nano::epoch_upgrader> (*this, ledger, store, network_params, logger) },
 	epoch_upgrader{ *epoch_upgrader_impl },
@@ -377,6 +380,12 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 			store.initialize (transaction, ledger.cache, ledger.constants);
 		}
 
+		if (flags.inactive_node && !flags.read_only)
+		{
+			// CLI commands can modify the store directly, bypassing the ledger, so persisted cache counts can't be trusted afterwards
+			ledger.cache_snapshot_del ();
+		}
+
 		if (!block_or_pruned_exists (config.network_params.ledger.genesis->hash ()))
 		{
 			logger.critical (nano::log::type::node, "Genesis block not found. This commonly indicates a configuration issue, check that the --network or --data_path command line arguments are correct, and also the ledger backend node config option. If using a read-only CLI command a ledger must already exist, start the node with --daemon first.");
@@ -724,12 +733,19 @@ void nano::node::stop ()
 	message_processor.stop ();
 	network.stop ();
 	monitor.stop ();
+	signature_checker.stop ();
 
 	bootstrap_workers.stop ();
 	wallet_workers.stop ();
 	election_workers.stop ();
 	workers.stop ();
 
+	// Nothing modifies the ledger anymore, persist cache counts so the next startup can skip scanning the ledger
+	if (!flags.read_only && !flags.inactive_node && !store.init_error ())
+	{
+		ledger.cache_snapshot_put ();
+	}
+
 	// work pool is not stopped on purpose due to testing setup
 
 	// Stop the IO runner last
@@ -1174,6 +1190,7 @@ nano::container_info nano::node::container_info () const
 	info.add ("vote_cache_processor", vote_cache_processor.container_info ());
 	info.add ("rep_crawler", rep_crawler.container_info ());
 	info.add ("block_processor", block_processor.container_info ());
+	info.add ("signature_checker", signature_checker.container_info ());
 	info.add ("online_reps", online_reps.container_info ());
 	info.add ("history", history.container_info ());
 	info.add ("block_uniquer", block_uniquer.container_info ());
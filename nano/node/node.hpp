@@ -145,6 +145,8 @@ public:
 	nano::transport::tcp_listener & tcp_listener;
 	std::unique_ptr<nano::port_mapping> port_mapping_impl;
 	nano::port_mapping & port_mapping;
+	std::unique_ptr<nano::signature_checker> signature_checker_impl;
+	nano::signature_checker & signature_checker;
 	std::unique_ptr<nano::block_processor> block_processor_impl;
 	nano::block_processor & block_processor;
 	std::unique_ptr<nano::confirming_set> confirming_set_impl;
@@ -32,6 +32,7 @@
 #include <nano/node/vote_cache.hpp>
 #include <nano/node/vote_processor.hpp>
 #include <nano/node/websocketconfig.hpp>
+#include <nano/secure/block_cache.hpp>
 #include <nano/secure/common.hpp>
 #include <nano/secure/generate_cache_flags.hpp>
 
@@ -75,6 +76,8 @@ public:
 	nano::amount vote_minimum{ nano::Knano_ratio }; // 1000 nano
 	nano::amount rep_crawler_weight_minimum{ "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF" };
 	std::chrono::milliseconds vote_generator_delay{ std::chrono::milliseconds (100) };
+	/* Votes for each local representative are signed in parallel. The generator thread signs as well, so these are extra worker threads */
+	unsigned vote_generator_threads{ std::min (nano::hardware_concurrency (), 4u) };
 	nano::amount online_weight_minimum{ 60000 * nano::Knano_ratio }; // 60 million nano
 	/*
 	 * The minimum vote weight that a representative must have for its vote to be counted.
@@ -128,6 +131,7 @@ public:
 	uint32_t max_queued_requests{ 512 };
 	unsigned request_aggregator_threads{ std::min (nano::hardware_concurrency (), 4u) }; // Max 4 threads if available
 	unsigned max_unchecked_blocks{ 65536 };
+	uint64_t max_unchecked_disk_blocks{ 1024 * 1024 };
 	std::size_t max_backlog{ 100000 };
 	std::chrono::seconds max_pruning_age{ !network_params.network.is_beta_network () ? std::chrono::seconds (24 * 60 * 60) : std::chrono::seconds (5 * 60) }; // 1 day; 5 minutes for beta network
 	uint64_t max_pruning_depth{ 0 };
@@ -137,6 +141,7 @@ public:
 
 public:
 	nano::vote_cache_config vote_cache;
+	nano::block_cache_config block_cache;
 	nano::rep_crawler_config rep_crawler;
 	nano::block_processor_config block_processor;
 	nano::active_elections_config active_elections;
@@ -71,13 +71,11 @@ void nano::request_aggregator::stop ()
 
 std::size_t nano::request_aggregator::size () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	return queue.size ();
 }
 
 bool nano::request_aggregator::empty () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	return queue.empty ();
 }
 
@@ -89,17 +87,20 @@ bool nano::request_aggregator::request (request_type const & request, std::share
 	debug_assert (wallets.reps ().voting > 0);
 	debug_assert (!request.empty ());
 
-	bool added = false;
-	{
-		nano::lock_guard<nano::mutex> guard{ mutex };
-		added = queue.push ({ request, channel }, { nano::no_value{}, channel });
-	}
+	bool added = queue.push ({ request, channel }, { nano::no_value{}, channel });
 	if (added)
 	{
 		stats.inc (nano::stat::type::request_aggregator, nano::stat::detail::request);
 		stats.add (nano::stat::type::request_aggregator, nano::stat::detail::request_hashes, request.size ());
 
-		condition.notify_one ();
+		if (sleeping > 0)
+		{
+			{
+				// Ensures a thread that just found the queue empty is already waiting on the condition
+				nano::lock_guard<nano::mutex> guard{ mutex };
+			}
+			condition.notify_one ();
+		}
 	}
 	else
 	{
@@ -128,7 +129,9 @@ void nano::request_aggregator::run ()
 		}
 		else
 		{
+			++sleeping;
 			condition.wait (lock, [&] { return stopped || !queue.empty (); });
+			--sleeping;
 		}
 	}
 }
@@ -137,13 +140,13 @@ void nano::request_aggregator::run_batch (nano::unique_lock<nano::mutex> & lock)
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
 
+	lock.unlock ();
+
+	// The queue is shared with other processing threads, the batch might be smaller than expected or even empty
 	debug_assert (config.batch_size > 0);
 	auto batch = queue.next_batch (config.batch_size);
 
-	lock.unlock ();
-
 	auto transaction = ledger.tx_begin_read ();
 
 	for (auto const & [value, origin] : batch)
@@ -258,8 +261,6 @@ auto nano::request_aggregator::aggregate (nano::secure::transaction const & tran
 
 nano::container_info nano::request_aggregator::container_info () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-
 	nano::container_info info;
 	info.add ("queue", queue.container_info ());
 	return info;
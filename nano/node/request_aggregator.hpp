@@ -3,7 +3,7 @@
 #include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
-#include <nano/node/fair_queue.hpp>
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/transport/channel.hpp>
 #include <nano/node/transport/transport.hpp>
@@ -94,9 +94,11 @@ private: // Dependencies
 
 private:
 	using value_type = std::pair<request_type, std::shared_ptr<nano::transport::channel>>;
-	nano::fair_queue<value_type, nano::no_value> queue;
+	nano::concurrent_fair_queue<value_type, nano::no_value> queue;
 
 	bool stopped{ false };
+	// Number of threads waiting for requests, producers only need to synchronize with the mutex when some thread might be sleeping
+	std::atomic<size_t> sleeping{ 0 };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::request_aggregator) };
 	std::vector<std::thread> threads;
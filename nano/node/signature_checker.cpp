@@ -0,0 +1,212 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/locks.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/node/signature_checker.hpp>
+#include <nano/secure/vote.hpp>
+
+#include <algorithm>
+
+nano::signature_checker::signature_checker (unsigned num_threads_a, std::size_t max_batch_size_a, nano::stats & stats_a) :
+	stats{ stats_a },
+	num_threads{ num_threads_a },
+	max_batch_size{ max_batch_size_a > 0 ? max_batch_size_a : default_batch_size }
+{
+	if (num_threads > 0)
+	{
+		workers = std::make_unique<nano::thread_pool> (num_threads, nano::thread_role::name::signature_checking, /* start immediately */ true);
+	}
+}
+
+nano::signature_checker::~signature_checker ()
+{
+	debug_assert (!workers || !workers->alive ());
+}
+
+void nano::signature_checker::stop ()
+{
+	if (workers)
+	{
+		workers->stop ();
+	}
+}
+
+std::vector<bool> nano::signature_checker::verify (std::vector<std::shared_ptr<nano::vote>> const & votes)
+{
+	check_set set{ votes.size (), /* batch */ true };
+	for (auto const & vote : votes)
+	{
+		set.hashes.push_back (vote->hash ());
+		set.public_keys.push_back (vote->account);
+		set.signatures.push_back (vote->signature);
+	}
+
+	verify (set);
+
+	auto results = set.results ();
+	stats.add (nano::stat::type::signature_checker, nano::stat::detail::vote, votes.size ());
+	stats.add (nano::stat::type::signature_checker, nano::stat::detail::invalid, std::count (results.begin (), results.end (), true));
+	return results;
+}
+
+std::vector<bool> nano::signature_checker::verify (std::vector<std::shared_ptr<nano::block>> const & blocks, std::vector<nano::public_key> const & signers)
+{
+	release_assert (blocks.size () == signers.size ());
+
+	// The ledger skips its own signature check for blocks verified here, so results must be exactly those of `validate_message`, which batch verification does not guarantee
+	check_set set{ blocks.size (), /* batch */ false };
+	for (std::size_t i = 0; i < blocks.size (); ++i)
+	{
+		set.hashes.push_back (blocks[i]->hash ());
+		set.public_keys.push_back (signers[i]);
+		set.signatures.push_back (blocks[i]->block_signature ());
+	}
+
+	verify (set);
+
+	auto results = set.results ();
+	stats.add (nano::stat::type::signature_checker, nano::stat::detail::block, blocks.size ());
+	stats.add (nano::stat::type::signature_checker, nano::stat::detail::invalid, std::count (results.begin (), results.end (), true));
+	return results;
+}
+
+void nano::signature_checker::verify (check_set & set)
+{
+	auto const size = set.size ();
+	if (size == 0)
+	{
+		return;
+	}
+
+	// Split the set evenly between the pool threads and the calling thread, keeping batches within size limits
+	auto const parallelism = workers ? num_threads + 1 : 1;
+	auto const batch_size = std::min (std::max ((size + parallelism - 1) / parallelism, min_batch_size), max_batch_size);
+	auto const batch_count = (size + batch_size - 1) / batch_size;
+
+	stats.add (nano::stat::type::signature_checker, nano::stat::detail::batch, batch_count);
+
+	if (batch_count == 1)
+	{
+		verify_range (set, 0, size);
+		return;
+	}
+
+	// Pool threads and the calling thread claim batches until none are left
+	// The state is shared, so tasks that start after verification has finished (or never start because the pool was stopped) are harmless
+	struct job
+	{
+		check_set * set;
+		std::size_t size;
+		std::size_t batch_size;
+		std::size_t batch_count;
+
+		std::atomic<std::size_t> next{ 0 };
+		std::size_t completed{ 0 };
+		nano::mutex mutex;
+		nano::condition_variable condition;
+
+		void run ()
+		{
+			std::size_t index;
+			while ((index = next.fetch_add (1)) < batch_count)
+			{
+				auto const begin = index * batch_size;
+				auto const end = std::min (begin + batch_size, size);
+				verify_range (*set, begin, end);
+				{
+					nano::lock_guard<nano::mutex> guard{ mutex };
+					++completed;
+				}
+				condition.notify_all ();
+			}
+		}
+	};
+
+	auto state = std::make_shared<job> ();
+	state->set = &set;
+	state->size = size;
+	state->batch_size = batch_size;
+	state->batch_count = batch_count;
+
+	auto const tasks = std::min<std::size_t> (batch_count - 1, num_threads);
+	for (std::size_t i = 0; i < tasks; ++i)
+	{
+		workers->post ([state] () {
+			state->run ();
+		});
+	}
+
+	state->run ();
+
+	nano::unique_lock<nano::mutex> lock{ state->mutex };
+	state->condition.wait (lock, [&state] () {
+		return state->completed == state->batch_count;
+	});
+}
+
+void nano::signature_checker::verify_range (check_set & set, std::size_t begin, std::size_t end)
+{
+	debug_assert (begin < end && end <= set.size ());
+
+	if (!set.batch)
+	{
+		for (auto i = begin; i < end; ++i)
+		{
+			set.valid[i] = nano::validate_message (set.public_keys[i], set.hashes[i], set.signatures[i]) ? 0 : 1;
+		}
+		return;
+	}
+
+	auto const count = end - begin;
+
+	std::vector<uint8_t const *> messages;
+	std::vector<uint8_t const *> public_keys;
+	std::vector<uint8_t const *> signatures;
+	messages.reserve (count);
+	public_keys.reserve (count);
+	signatures.reserve (count);
+	for (auto i = begin; i < end; ++i)
+	{
+		messages.push_back (set.hashes[i].bytes.data ());
+		public_keys.push_back (set.public_keys[i].bytes.data ());
+		signatures.push_back (set.signatures[i].bytes.data ());
+	}
+	std::vector<std::size_t> lengths (count, sizeof (nano::block_hash));
+
+	nano::validate_message_batch (messages.data (), lengths.data (), public_keys.data (), signatures.data (), count, set.valid.data () + begin);
+}
+
+nano::container_info nano::signature_checker::container_info () const
+{
+	nano::container_info info;
+	if (workers)
+	{
+		info.add ("workers", workers->container_info ());
+	}
+	return info;
+}
+
+/*
+ * check_set
+ */
+
+nano::signature_checker::check_set::check_set (std::size_t size, bool batch_a) :
+	batch{ batch_a },
+	valid (size, 0)
+{
+	hashes.reserve (size);
+	public_keys.reserve (size);
+	signatures.reserve (size);
+}
+
+std::size_t nano::signature_checker::check_set::size () const
+{
+	debug_assert (hashes.size () == valid.size ());
+	return hashes.size ();
+}
+
+std::vector<bool> nano::signature_checker::check_set::results () const
+{
+	std::vector<bool> results (valid.size ());
+	std::transform (valid.begin (), valid.end (), results.begin (), [] (int valid) { return valid != 1; });
+	return results;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/thread_pool.hpp>
+#include <nano/node/fwd.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Verifies block and vote signatures in parallel using a shared pool of threads.
+ * Signatures are split into batches. Vote batches are checked with ed25519 batch verification, block signatures are checked
+ * individually since the ledger relies on the result and it must match `validate_message` exactly.
+ * The calling thread also takes part in the verification, so checking works even with zero pool threads.
+ */
+class signature_checker final
+{
+public:
+	/**
+	 * @param num_threads Number of additional threads dedicated to signature verification
+	 * @param max_batch_size Maximum number of signatures verified in a single batch, 0 selects the default
+	 */
+	signature_checker (unsigned num_threads, std::size_t max_batch_size, nano::stats &);
+	~signature_checker ();
+
+	void stop ();
+
+	/**
+	 * Verifies that each vote is signed by its voting account
+	 * @returns per vote results in the same order as the input, true if the signature is invalid
+	 */
+	std::vector<bool> verify (std::vector<std::shared_ptr<nano::vote>> const &);
+
+	/**
+	 * Verifies that each block is signed by the corresponding signer
+	 * @returns per block results in the same order as the input, true if the signature is invalid
+	 */
+	std::vector<bool> verify (std::vector<std::shared_ptr<nano::block>> const &, std::vector<nano::public_key> const & signers);
+
+	nano::container_info container_info () const;
+
+	static std::size_t constexpr default_batch_size = 256;
+	// Batches smaller than this are not worth dispatching to another thread
+	static std::size_t constexpr min_batch_size = 64;
+
+private: // Dependencies
+	nano::stats & stats;
+
+private:
+	struct check_set
+	{
+		check_set (std::size_t size, bool batch);
+
+		// Use ed25519 batch verification, otherwise each signature is checked with `validate_message`
+		bool const batch;
+		std::vector<nano::block_hash> hashes;
+		std::vector<nano::public_key> public_keys;
+		std::vector<nano::signature> signatures;
+		// Set to 1 for every valid signature
+		std::vector<int> valid;
+
+		std::size_t size () const;
+		std::vector<bool> results () const;
+	};
+
+	void verify (check_set &);
+	static void verify_range (check_set &, std::size_t begin, std::size_t end);
+
+private:
+	unsigned const num_threads;
+	std::size_t const max_batch_size;
+	std::unique_ptr<nano::thread_pool> workers;
+};
+}
@@ -16,9 +16,13 @@ nano::transport::channel::channel (nano::node & node_a) :
 
 bool nano::transport::channel::send (nano::message const & message, nano::transport::traffic_type traffic_type, callback_t callback)
 {
-	auto buffer = message.to_shared_const_buffer ();
+	return send (message.to_shared_const_buffer (), message.type (), traffic_type, std::move (callback));
+}
+
+bool nano::transport::channel::send (nano::shared_const_buffer const & buffer, nano::message_type message_type, nano::transport::traffic_type traffic_type, callback_t callback)
+{
 	bool sent = send_buffer (buffer, traffic_type, std::move (callback));
-	node.stats.inc (sent ? nano::stat::type::message : nano::stat::type::drop, to_stat_detail (message.type ()), nano::stat::dir::out, /* aggregate all */ true);
+	node.stats.inc (sent ? nano::stat::type::message : nano::stat::type::drop, to_stat_detail (message_type), nano::stat::dir::out, /* aggregate all */ true);
 	return sent;
 }
 
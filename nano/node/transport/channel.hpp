@@ -31,6 +31,9 @@ public:
 
 	/// @returns true if the message was sent (or queued to be sent), false if it was immediately dropped
 	bool send (nano::message const &, nano::transport::traffic_type, callback_t = nullptr);
+	/// Sends an already serialized message, allows the same buffer to be shared by many channels
+	/// @returns true if the message was sent (or queued to be sent), false if it was immediately dropped
+	bool send (nano::shared_const_buffer const &, nano::message_type, nano::transport::traffic_type, callback_t = nullptr);
 
 	virtual void close () = 0;
 
@@ -2,6 +2,8 @@
 #include <nano/node/node.hpp>
 #include <nano/node/transport/message_deserializer.hpp>
 
+#include <cstring>
+
 nano::transport::message_deserializer::message_deserializer (nano::network_constants const & network_constants_a, nano::network_filter & network_filter_a, nano::block_uniquer & block_uniquer_a, nano::vote_uniquer & vote_uniquer_a,
 read_query read_op) :
 	read_buffer{ std::make_shared<std::vector<uint8_t>> () },
@@ -12,7 +14,7 @@ read_query read_op) :
 	read_op{ std::move (read_op) }
 {
 	debug_assert (this->read_op);
-	read_buffer->resize (MAX_MESSAGE_SIZE);
+	read_buffer->resize (READ_BUFFER_SIZE);
 }
 
 void nano::transport::message_deserializer::read (const nano::transport::message_deserializer::callback_type && callback)
@@ -20,34 +22,123 @@ void nano::transport::message_deserializer::read (const nano::transport::message
 	debug_assert (callback);
 	debug_assert (read_op);
 
-	status = parse_status::none;
+	if (processing)
+	{
+		// Called from within the callback, the processing loop will pick it up once the callback returns
+		debug_assert (!pending_callback);
+		pending_callback = std::move (callback);
+		return;
+	}
+	process (std::move (callback));
+}
+
+void nano::transport::message_deserializer::process (callback_type callback)
+{
+	debug_assert (!processing);
+
+	std::size_t missing = 0;
+	processing = true;
+	while (true)
+	{
+		missing = process_buffered (callback);
+		if (missing > 0 || !pending_callback)
+		{
+			break;
+		}
+		callback = std::move (pending_callback);
+		pending_callback = nullptr;
+	}
+	processing = false;
+
+	if (missing == 0)
+	{
+		return; // Callback was called and no further read was requested
+	}
 
-	read_op (read_buffer, HEADER_SIZE, [this_l = shared_from_this (), callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
+	// Move the incomplete message to the front, so the remaining buffer space can be filled with as much data as available
+	if (read_begin > 0)
+	{
+		std::memmove (read_buffer->data (), read_buffer->data () + read_begin, read_end - read_begin);
+		read_end -= read_begin;
+		read_begin = 0;
+	}
+	debug_assert (read_end + missing <= read_buffer->size ());
+
+	debug_assert (read_op);
+	read_op (read_buffer, read_end, missing, [this_l = shared_from_this (), missing, callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
 		if (ec)
 		{
 			callback (ec, nullptr);
 			return;
 		}
-		if (size_a != HEADER_SIZE)
+		if (size_a < missing || this_l->read_end + size_a > this_l->read_buffer->size ())
 		{
 			callback (boost::asio::error::fault, nullptr);
 			return;
 		}
-		this_l->received_header (std::move (callback));
+		this_l->read_end += size_a;
+		this_l->process (std::move (callback));
 	});
 }
 
-void nano::transport::message_deserializer::received_header (const nano::transport::message_deserializer::callback_type && callback)
+std::size_t nano::transport::message_deserializer::process_buffered (callback_type const & callback)
 {
-	nano::bufferstream stream{ read_buffer->data (), HEADER_SIZE };
+	status = parse_status::none;
+
+	auto const available = read_end - read_begin;
+	if (available < HEADER_SIZE)
+	{
+		return HEADER_SIZE - available;
+	}
+
+	// Header is parsed on each attempt, it's cheap and avoids keeping partial parse state
+	uint8_t const * data = read_buffer->data () + read_begin;
+	nano::bufferstream stream{ data, HEADER_SIZE };
 	auto error = false;
 	nano::message_header header{ error, stream };
 	if (error)
 	{
 		status = parse_status::invalid_header;
 		callback (boost::asio::error::fault, nullptr);
-		return;
+		return 0;
+	}
+	if (!validate_header (header))
+	{
+		callback (boost::asio::error::fault, nullptr);
+		return 0;
+	}
+
+	std::size_t const payload_size = header.payload_length_bytes ();
+	if (available < HEADER_SIZE + payload_size)
+	{
+		return HEADER_SIZE + payload_size - available;
 	}
+
+	// Payload size will be 0 for `bulk_push` & `telemetry_req` message type
+	auto message = deserialize (header, data + HEADER_SIZE, payload_size);
+
+	read_begin += HEADER_SIZE + payload_size;
+	if (read_begin == read_end)
+	{
+		read_begin = read_end = 0;
+	}
+
+	if (message)
+	{
+		debug_assert (status == parse_status::none);
+		status = parse_status::success;
+		callback (boost::system::error_code{}, std::move (message));
+	}
+	else
+	{
+		debug_assert (status != parse_status::none);
+		callback (boost::system::error_code{}, nullptr);
+	}
+	return 0;
+}
+
+bool nano::transport::message_deserializer::validate_header (nano::message_header const & header)
+{
 	// Validate network magic number
 	bool network_matches = false;
 	if (network_constants_m.current_network == nano::networks::nano_live_network)
@@ -67,75 +158,30 @@ void nano::transport::message_deserializer::received_header (const nano::transpo
 	if (!network_matches)
 	{
 		status = parse_status::invalid_network;
-		callback (boost::asio::error::fault, nullptr);
-		return;
+		return false;
 	}
 	if (header.version_using < network_constants_m.protocol_version_min)
 	{
 		status = parse_status::outdated_version;
-		callback (boost::asio::error::fault, nullptr);
-		return;
+		return false;
 	}
 	if (!header.is_valid_message_type ())
 	{
 		status = parse_status::invalid_header;
-		callback (boost::asio::error::fault, nullptr);
-		return;
+		return false;
 	}
-
-	std::size_t payload_size = header.payload_length_bytes ();
-	if (payload_size > MAX_MESSAGE_SIZE)
+	if (header.payload_length_bytes () > MAX_MESSAGE_SIZE)
 	{
 		status = parse_status::message_size_too_big;
-		callback (boost::asio::error::fault, nullptr);
-		return;
-	}
-	debug_assert (payload_size <= read_buffer->capacity ());
-
-	if (payload_size == 0)
-	{
-		// Payload size will be 0 for `bulk_push` & `telemetry_req` message type
-		received_message (header, 0, std::move (callback));
-	}
-	else
-	{
-		debug_assert (read_op);
-		read_op (read_buffer, payload_size, [this_l = shared_from_this (), payload_size, header, callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
-			if (ec)
-			{
-				callback (ec, nullptr);
-				return;
-			}
-			if (size_a != payload_size)
-			{
-				callback (boost::asio::error::fault, nullptr);
-				return;
-			}
-			this_l->received_message (header, size_a, std::move (callback));
-		});
-	}
-}
-
-void nano::transport::message_deserializer::received_message (nano::message_header header, std::size_t payload_size, const nano::transport::message_deserializer::callback_type && callback)
-{
-	auto message = deserialize (header, payload_size);
-	if (message)
-	{
-		debug_assert (status == parse_status::none);
-		status = parse_status::success;
-		callback (boost::system::error_code{}, std::move (message));
-	}
-	else
-	{
-		debug_assert (status != parse_status::none);
-		callback (boost::system::error_code{}, nullptr);
+		return false;
 	}
+	return true;
 }
 
-std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, std::size_t payload_size)
+std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, uint8_t const * payload, std::size_t payload_size)
 {
 	release_assert (payload_size <= MAX_MESSAGE_SIZE);
-	nano::bufferstream stream{ read_buffer->data (), payload_size };
+	nano::bufferstream stream{ payload, payload_size };
 	switch (header.type)
 	{
 		case nano::message_type::keepalive:
@@ -146,7 +192,7 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (payload, payload_size, &digest))
 			{
 				return deserialize_publish (stream, header, digest);
 			}
@@ -164,7 +210,7 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (payload, payload_size, &digest))
 			{
 				return deserialize_confirm_ack (stream, header, digest);
 			}
@@ -44,7 +44,10 @@ namespace transport
 
 		parse_status status{ parse_status::none };
 
-		using read_query = std::function<void (std::shared_ptr<std::vector<uint8_t>> const &, size_t, std::function<void (boost::system::error_code const &, std::size_t)>)>;
+		/*
+		 * Reads at least `min_size` bytes into the buffer starting at `offset`, more can be read if available, up to the end of the buffer
+		 */
+		using read_query = std::function<void (std::shared_ptr<std::vector<uint8_t>> const & buffer, std::size_t offset, std::size_t min_size, std::function<void (boost::system::error_code const &, std::size_t)>)>;
 
 		message_deserializer (nano::network_constants const &, nano::network_filter &, nano::block_uniquer &, nano::vote_uniquer &, read_query read_op);
 
@@ -54,18 +57,24 @@ namespace transport
 		 * If a 'soft' error is encountered (eg. duplicate block publish) error won't be set but message will be null. In that case, `status` field will be set to code indicating reason for failure.
 		 * If message is received successfully, error code won't be set and message will be non-null. `status` field will be set to `success`.
 		 * Should not be called until the previous invocation finishes and calls the callback.
+		 * Data is read in chunks that can contain multiple messages, messages already buffered are returned without reading from the channel.
 		 */
 		void read (callback_type const && callback);
 
 	private:
-		void received_header (callback_type const && callback);
-		void received_message (nano::message_header header, std::size_t payload_size, callback_type const && callback);
+		void process (callback_type callback);
+		/*
+		 * Parses the next message in place from buffered data
+		 * @return number of bytes that need to be read before the next message is complete, 0 if the callback was called
+		 */
+		std::size_t process_buffered (callback_type const & callback);
+		bool validate_header (nano::message_header const & header);
 
 		/*
-		 * Deserializes message using data in `read_buffer`.
+		 * Deserializes message using payload data from `read_buffer`.
 		 * @return If successful returns non-null message, otherwise sets `status` to error appropriate code and returns nullptr
 		 */
-		std::unique_ptr<nano::message> deserialize (nano::message_header header, std::size_t payload_size);
+		std::unique_ptr<nano::message> deserialize (nano::message_header header, uint8_t const * payload, std::size_t payload_size);
 		std::unique_ptr<nano::keepalive> deserialize_keepalive (nano::stream &, nano::message_header const &);
 		std::unique_ptr<nano::publish> deserialize_publish (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest);
 		std::unique_ptr<nano::confirm_req> deserialize_confirm_req (nano::stream &, nano::message_header const &);
@@ -81,11 +90,20 @@ namespace transport
 		std::unique_ptr<nano::asc_pull_ack> deserialize_asc_pull_ack (nano::stream &, nano::message_header const &);
 
 	private:
+		// Holds data read from the channel, [read_begin, read_end) is the part that wasn't processed yet
 		std::shared_ptr<std::vector<uint8_t>> read_buffer;
+		std::size_t read_begin{ 0 };
+		std::size_t read_end{ 0 };
+
+		// Used to return buffered messages in a loop instead of recursing when `read` is called from within the callback
+		bool processing{ false };
+		callback_type pending_callback;
 
 	private: // Constants
 		static constexpr std::size_t HEADER_SIZE = 8;
 		static constexpr std::size_t MAX_MESSAGE_SIZE = 1024 * 65;
+		// Large enough for any single message, smaller messages can be received in batches
+		static constexpr std::size_t READ_BUFFER_SIZE = HEADER_SIZE + MAX_MESSAGE_SIZE;
 
 	private: // Dependencies
 		nano::network_constants const & network_constants_m;
@@ -94,16 +94,27 @@ void nano::transport::tcp_socket::async_connect (nano::tcp_endpoint const & endp
 }
 
 void nano::transport::tcp_socket::async_read (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	async_read_impl (buffer_a, 0, size_a, size_a, std::move (callback_a));
+}
+
+void nano::transport::tcp_socket::async_read_some (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, std::size_t offset_a, std::size_t min_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	debug_assert (offset_a <= buffer_a->size ());
+	async_read_impl (buffer_a, offset_a, min_size_a, buffer_a->size () - std::min (offset_a, buffer_a->size ()), std::move (callback_a));
+}
+
+void nano::transport::tcp_socket::async_read_impl (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, std::size_t offset_a, std::size_t min_size_a, std::size_t max_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
 {
 	debug_assert (callback_a);
 
-	if (size_a <= buffer_a->size ())
+	if (min_size_a <= max_size_a && offset_a + max_size_a <= buffer_a->size ())
 	{
 		if (!closed)
 		{
 			set_default_timeout ();
-			boost::asio::post (strand, [this_l = shared_from_this (), buffer_a, callback = std::move (callback_a), size_a] () mutable {
-				boost::asio::async_read (this_l->raw_socket, boost::asio::buffer (buffer_a->data (), size_a),
+			boost::asio::post (strand, [this_l = shared_from_this (), buffer_a, callback = std::move (callback_a), offset_a, min_size_a, max_size_a] () mutable {
+				boost::asio::async_read (this_l->raw_socket, boost::asio::buffer (buffer_a->data () + offset_a, max_size_a), boost::asio::transfer_at_least (min_size_a),
 				boost::asio::bind_executor (this_l->strand,
 				[this_l, buffer_a, cbk = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
 					debug_assert (this_l->strand.running_in_this_thread ());
@@ -329,7 +340,7 @@ void nano::transport::tcp_socket::ongoing_checkup ()
 	});
 }
 
-void nano::transport::tcp_socket::read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+void nano::transport::tcp_socket::read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t min_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
 {
 	auto node_l = node_w.lock ();
 	if (!node_l)
@@ -340,7 +351,7 @@ void nano::transport::tcp_socket::read_impl (std::shared_ptr<std::vector<uint8_t
 	// Increase timeout to receive TCP header (idle server socket)
 	auto const prev_timeout = get_default_timeout_value ();
 	set_default_timeout_value (node_l->network_params.network.idle_timeout);
-	async_read (data_a, size_a, [callback_l = std::move (callback_a), prev_timeout, this_l = shared_from_this ()] (boost::system::error_code const & ec_a, std::size_t size_a) {
+	async_read_some (data_a, offset_a, min_size_a, [callback_l = std::move (callback_a), prev_timeout, this_l = shared_from_this ()] (boost::system::error_code const & ec_a, std::size_t size_a) {
 		this_l->set_default_timeout_value (prev_timeout);
 		callback_l (ec_a, size_a);
 	});
@@ -95,6 +95,16 @@ public:
 	std::size_t size,
 	std::function<void (boost::system::error_code const &, std::size_t)> callback);
 
+	/**
+	 * Reads at least `min_size` bytes into `buffer` starting at `offset`, possibly more if already available, up to the end of the buffer
+	 * Allows reading multiple messages with a single call
+	 */
+	void async_read_some (
+	std::shared_ptr<std::vector<uint8_t>> const & buffer,
+	std::size_t offset,
+	std::size_t min_size,
+	std::function<void (boost::system::error_code const &, std::size_t)> callback);
+
 	void async_write (
 	nano::shared_const_buffer const &,
 	std::function<void (boost::system::error_code const &, std::size_t)> callback = nullptr);
@@ -194,7 +204,8 @@ protected:
 	void set_last_completion ();
 	void set_last_receive_time ();
 	void ongoing_checkup ();
-	void read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
+	void read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t min_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
+	void async_read_impl (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, std::size_t offset_a, std::size_t min_size_a, std::size_t max_size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
 
 private:
 	socket_endpoint const endpoint_type_m;
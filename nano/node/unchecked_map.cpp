@@ -1,10 +1,12 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/locks.hpp>
+#include <nano/lib/logging.hpp>
 #include <nano/lib/stats.hpp>
 #include <nano/lib/stats_enums.hpp>
 #include <nano/lib/thread_roles.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/node/unchecked_map.hpp>
+#include <nano/node/unchecked_spill.hpp>
 
 nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::stats & stats, bool const & disable_delete) :
 	max_unchecked_blocks{ max_unchecked_blocks },
@@ -13,6 +15,20 @@ nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::s
 {
 }
 
+nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, uint64_t const max_spilled_blocks, std::filesystem::path const & spill_path, nano::stats & stats, nano::logger & logger, bool const & disable_delete) :
+	unchecked_map{ max_unchecked_blocks, stats, disable_delete }
+{
+	if (max_spilled_blocks > 0)
+	{
+		spill = std::make_unique<nano::unchecked_spill> (spill_path, max_spilled_blocks);
+		if (spill->init_error ())
+		{
+			logger.error (nano::log::type::unchecked, "Unable to open unchecked blocks database: {}, unchecked blocks will only be kept in memory", spill_path.string ());
+			spill.reset ();
+		}
+	}
+}
+
 nano::unchecked_map::~unchecked_map ()
 {
 	debug_assert (!thread.joinable ());
@@ -44,16 +60,69 @@ void nano::unchecked_map::stop ()
 
 void nano::unchecked_map::put (nano::hash_or_account const & dependency, nano::unchecked_info const & info)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	nano::unchecked_key key{ dependency, info.block->hash () };
-	entries.get<tag_root> ().insert ({ key, info });
+	std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> spilled;
+	{
+		nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
+		nano::unchecked_key key{ dependency, info.block->hash () };
+		// An entry already moved out of memory keeps its place there, a second copy in memory would be returned twice
+		if (spilling.count (key) != 0 || (spill && spill->exists (key)))
+		{
+			return;
+		}
+		entries.get<tag_root> ().insert ({ key, info });
 
-	if (entries.size () > max_unchecked_blocks)
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::put);
+
+		if (entries.size () > max_unchecked_blocks)
+		{
+			if (spill)
+			{
+				// Move the oldest entries to disk, making room for a batch of new ones
+				// Until the batch is written they are kept in `spilling`, so queries always find an entry in one of the tiers
+				auto count = std::min (entries.size (), entries.size () - max_unchecked_blocks + spill_batch_size - 1);
+				spilled.reserve (count);
+				auto & sequenced = entries.get<tag_sequenced> ();
+				while (spilled.size () < count)
+				{
+					spilled.emplace_back (sequenced.front ().key, sequenced.front ().info);
+					spilling.emplace (sequenced.front ().key, sequenced.front ().info);
+					sequenced.pop_front ();
+				}
+			}
+			else
+			{
+				entries.get<tag_sequenced> ().pop_front ();
+				stats.inc (nano::stat::type::unchecked, nano::stat::detail::evicted);
+			}
+		}
+	}
+	if (!spilled.empty ())
 	{
-		entries.get<tag_sequenced> ().pop_front ();
+		spill_batch (spilled);
 	}
+}
+
+void nano::unchecked_map::spill_batch (std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> const & batch)
+{
+	// The disk write happens without holding the lock, other callers don't wait for it
+	auto dropped = spill->put (batch);
+	stats.add (nano::stat::type::unchecked, nano::stat::detail::spill, batch.size () - dropped);
+	stats.add (nano::stat::type::unchecked, nano::stat::detail::overfill, dropped);
 
-	stats.inc (nano::stat::type::unchecked, nano::stat::detail::put);
+	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
+	std::deque<nano::unchecked_key> removed;
+	for (auto const & [key, info] : batch)
+	{
+		if (spilling.erase (key) == 0)
+		{
+			// Deleted or satisfied while it was being written
+			removed.push_back (key);
+		}
+	}
+	if (!removed.empty ())
+	{
+		spill->del (removed);
+	}
 }
 
 void nano::unchecked_map::for_each (std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
@@ -63,6 +132,21 @@ void nano::unchecked_map::for_each (std::function<void (nano::unchecked_key cons
 	{
 		action (i->key, i->info);
 	}
+	for (auto i = spilling.begin (), n = spilling.end (); predicate () && i != n; ++i)
+	{
+		action (i->first, i->second);
+	}
+	if (spill)
+	{
+		// Entries of a batch that is still being spilled may already be on disk
+		spill->for_each ([this, &action] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+			if (spilling.count (key) == 0)
+			{
+				action (key, info);
+			}
+		},
+		predicate);
+	}
 }
 
 void nano::unchecked_map::for_each (nano::hash_or_account const & dependency, std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
@@ -72,6 +156,20 @@ void nano::unchecked_map::for_each (nano::hash_or_account const & dependency, st
 	{
 		action (i->key, i->info);
 	}
+	for (auto i = spilling.lower_bound (nano::unchecked_key{ dependency, 0 }), n = spilling.end (); predicate () && i != n && i->first.key () == dependency.as_block_hash (); ++i)
+	{
+		action (i->first, i->second);
+	}
+	if (spill)
+	{
+		spill->for_each (dependency, [this, &action] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+			if (spilling.count (key) == 0)
+			{
+				action (key, info);
+			}
+		},
+		predicate);
+	}
 }
 
 std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash const & hash)
@@ -86,13 +184,22 @@ std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash con
 bool nano::unchecked_map::exists (nano::unchecked_key const & key) const
 {
 	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.get<tag_root> ().count (key) != 0;
+	return entries.get<tag_root> ().count (key) != 0 || spilling.count (key) != 0 || (spill && spill->exists (key));
 }
 
 void nano::unchecked_map::del (nano::unchecked_key const & key)
 {
 	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
 	auto erased = entries.get<tag_root> ().erase (key);
+	if (!erased)
+	{
+		// The batch write removes it from disk again once it completes
+		erased = spilling.erase (key);
+	}
+	if (!erased && spill)
+	{
+		erased = spill->del ({ key });
+	}
 	debug_assert (erased);
 }
 
@@ -100,12 +207,22 @@ void nano::unchecked_map::clear ()
 {
 	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
 	entries.clear ();
+	spilling.clear ();
+	if (spill)
+	{
+		spill->clear ();
+	}
 }
 
 size_t nano::unchecked_map::entries_size () const
 {
 	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.size ();
+	return entries.size () + spilling.size ();
+}
+
+size_t nano::unchecked_map::spilled_size () const
+{
+	return spill ? spill->size () : 0;
 }
 
 size_t nano::unchecked_map::queries_size () const
@@ -116,7 +233,7 @@ size_t nano::unchecked_map::queries_size () const
 
 size_t nano::unchecked_map::count () const
 {
-	return entries_size ();
+	return entries_size () + spilled_size ();
 }
 
 void nano::unchecked_map::trigger (nano::hash_or_account const & dependency)
@@ -162,17 +279,47 @@ void nano::unchecked_map::run ()
 
 void nano::unchecked_map::query_impl (nano::block_hash const & hash)
 {
+	// Both tiers are drained under the same lock, so entries can't move to disk between looking them up and deleting them
+	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
+
+	std::vector<nano::unchecked_key> in_memory;
 	std::deque<nano::unchecked_key> delete_queue;
-	for_each (hash, [this, &delete_queue] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		delete_queue.push_back (key);
+	auto satisfy = [this] (nano::unchecked_info const & info) {
 		stats.inc (nano::stat::type::unchecked, nano::stat::detail::satisfied);
 		satisfied.notify (info);
-	});
+	};
+	for (auto i = entries.get<tag_root> ().lower_bound (nano::unchecked_key{ hash, 0 }), n = entries.get<tag_root> ().end (); i != n && i->key.key () == hash; ++i)
+	{
+		in_memory.push_back (i->key);
+		satisfy (i->info);
+	}
+	for (auto i = spilling.lower_bound (nano::unchecked_key{ hash, 0 }), n = spilling.end (); i != n && i->first.key () == hash; ++i)
+	{
+		in_memory.push_back (i->first);
+		satisfy (i->second);
+	}
+	if (spill)
+	{
+		spill->for_each (hash, [this, &delete_queue, &satisfy] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
+			if (spilling.count (key) == 0)
+			{
+				delete_queue.push_back (key);
+				satisfy (info);
+			}
+		},
+		[] () { return true; });
+	}
 	if (!disable_delete)
 	{
-		for (auto const & key : delete_queue)
+		for (auto const & key : in_memory)
+		{
+			// Entries still in `spilling` are removed from disk by their batch once it is written
+			auto erased = entries.get<tag_root> ().erase (key) + spilling.erase (key);
+			debug_assert (erased);
+		}
+		if (!delete_queue.empty ())
 		{
-			del (key);
+			spill->del (delete_queue);
 		}
 	}
 }
@@ -181,6 +328,7 @@ nano::container_info nano::unchecked_map::container_info () const
 {
 	nano::container_info info;
 	info.put ("entries", entries_size ());
+	info.put ("spilled", spilled_size ());
 	info.put ("queries", queries_size ());
 	return info;
 }
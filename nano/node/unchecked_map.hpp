@@ -11,18 +11,28 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <filesystem>
+#include <map>
+#include <memory>
 #include <thread>
 
 namespace mi = boost::multi_index;
 
 namespace nano
 {
+class logger;
 class stats;
+class unchecked_spill;
 
+/**
+ * Blocks waiting for a dependency, kept in memory up to `max_unchecked_blocks`.
+ * When a spill path is given, the oldest entries past the memory limit are moved to disk instead of being dropped, up to `max_spilled_blocks`.
+ */
 class unchecked_map
 {
 public:
 	unchecked_map (unsigned const max_unchecked_blocks, nano::stats &, bool const & do_delete);
+	unchecked_map (unsigned const max_unchecked_blocks, uint64_t const max_spilled_blocks, std::filesystem::path const & spill_path, nano::stats &, nano::logger &, bool const & do_delete);
 	~unchecked_map ();
 
 	void start ();
@@ -43,8 +53,9 @@ public:
 	 */
 	void trigger (nano::hash_or_account const & dependency);
 
-	size_t count () const; // Same as `entries_size ()`
+	size_t count () const; // Entries in memory and on disk
 	size_t entries_size () const;
+	size_t spilled_size () const;
 	size_t queries_size () const;
 
 	nano::container_info container_info () const;
@@ -55,6 +66,7 @@ public: // Events
 private:
 	void run ();
 	void query_impl (nano::block_hash const & hash);
+	void spill_batch (std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> const &);
 
 private: // Dependencies
 	nano::stats & stats;
@@ -72,6 +84,11 @@ private:
 
 	unsigned const max_unchecked_blocks;
 
+	/** Disk tier, null when spilling is disabled */
+	std::unique_ptr<nano::unchecked_spill> spill;
+	/** Entries are moved to disk in batches, so each write transaction carries more than a single entry */
+	static std::size_t constexpr spill_batch_size = 256;
+
 	void process_queries (decltype (buffer) const & back_buffer);
 
 private:
@@ -92,7 +109,9 @@ private:
 				mi::member<entry, nano::unchecked_key, &entry::key>>>>;
 	// clang-format on
 	ordered_unchecked entries;
+	/** Entries taken out of memory while their batch is written to disk, queries still find them here */
+	std::map<nano::unchecked_key, nano::unchecked_info> spilling;
 
-	mutable std::recursive_mutex entries_mutex; // Protects entries
+	mutable std::recursive_mutex entries_mutex; // Protects entries and spilling
 };
 }
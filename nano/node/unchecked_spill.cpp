@@ -0,0 +1,154 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/node/unchecked_spill.hpp>
+#include <nano/store/lmdb/db_val.hpp>
+
+#include <algorithm>
+
+namespace
+{
+/** Leaves room for the block, key and btree overhead of every entry, the map is sparse so unused space is not allocated */
+std::size_t map_size (uint64_t max_entries)
+{
+	return std::max<std::size_t> (max_entries * 2048, 64ULL * 1024 * 1024);
+}
+}
+
+nano::unchecked_spill::unchecked_spill (std::filesystem::path const & path_a, uint64_t max_entries_a) :
+	max_entries{ max_entries_a },
+	env{ error, path_a, nano::store::lmdb::env::options::make ().override_config_sync (nano::lmdb_config::sync_strategy::nosync_safe).override_config_map_size (map_size (max_entries_a)) }
+{
+	if (!error)
+	{
+		auto transaction (env.tx_begin_write ());
+		error = mdb_dbi_open (env.tx (transaction), "unchecked", MDB_CREATE, &handle) != MDB_SUCCESS;
+		if (!error)
+		{
+			// Like the in memory tier, entries are not kept across restarts. Their dependency may have arrived in the meantime or never will,
+			// and nothing else would remove them from the disk budget
+			error = mdb_drop (env.tx (transaction), handle, 0) != MDB_SUCCESS;
+		}
+	}
+	if (!error)
+	{
+		env.enable_read_pool ();
+	}
+}
+
+bool nano::unchecked_spill::init_error () const
+{
+	return error;
+}
+
+std::size_t nano::unchecked_spill::put (std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> const & entries_a)
+{
+	std::size_t dropped = 0;
+	auto transaction (env.tx_begin_write ());
+	for (auto const & [key, info] : entries_a)
+	{
+		if (entries >= max_entries)
+		{
+			++dropped;
+			continue;
+		}
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream (bytes);
+			info.serialize (stream);
+		}
+		auto status (mdb_put (env.tx (transaction), handle, nano::store::lmdb::db_val (to_union (key)), nano::store::lmdb::db_val (bytes.size (), bytes.data ()), MDB_NOOVERWRITE));
+		release_assert (status == MDB_SUCCESS || status == MDB_KEYEXIST, mdb_strerror (status));
+		if (status == MDB_SUCCESS)
+		{
+			++entries;
+		}
+	}
+	return dropped;
+}
+
+void nano::unchecked_spill::for_each (action_t const & action, predicate_t const & predicate) const
+{
+	for_each_impl (nano::unchecked_key{}, [] (nano::unchecked_key const &) { return true; }, action, predicate);
+}
+
+void nano::unchecked_spill::for_each (nano::hash_or_account const & dependency, action_t const & action, predicate_t const & predicate) const
+{
+	for_each_impl (nano::unchecked_key{ dependency, 0 }, [&dependency] (nano::unchecked_key const & key) { return key.key () == dependency.as_block_hash (); }, action, predicate);
+}
+
+void nano::unchecked_spill::for_each_impl (nano::unchecked_key const & start, std::function<bool (nano::unchecked_key const &)> const & condition, action_t const & action, predicate_t const & predicate) const
+{
+	if (entries == 0)
+	{
+		return;
+	}
+	auto transaction (env.tx_begin_read ());
+	MDB_cursor * cursor;
+	auto status (mdb_cursor_open (env.tx (transaction), handle, &cursor));
+	release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+	nano::store::lmdb::db_val key_val (to_union (start));
+	MDB_val value;
+	for (status = mdb_cursor_get (cursor, &key_val.value, &value, MDB_SET_RANGE); status == MDB_SUCCESS && predicate (); status = mdb_cursor_get (cursor, &key_val.value, &value, MDB_NEXT))
+	{
+		nano::unchecked_key key{ static_cast<nano::uint512_union> (key_val) };
+		if (!condition (key))
+		{
+			break;
+		}
+		nano::unchecked_info info;
+		nano::bufferstream stream (static_cast<uint8_t const *> (value.mv_data), value.mv_size);
+		if (!info.deserialize (stream))
+		{
+			action (key, info);
+		}
+	}
+	mdb_cursor_close (cursor);
+}
+
+bool nano::unchecked_spill::exists (nano::unchecked_key const & key) const
+{
+	if (entries == 0)
+	{
+		return false;
+	}
+	auto transaction (env.tx_begin_read ());
+	MDB_val value;
+	auto status (mdb_get (env.tx (transaction), handle, nano::store::lmdb::db_val (to_union (key)), &value));
+	release_assert (status == MDB_SUCCESS || status == MDB_NOTFOUND, mdb_strerror (status));
+	return status == MDB_SUCCESS;
+}
+
+std::size_t nano::unchecked_spill::del (std::deque<nano::unchecked_key> const & keys)
+{
+	std::size_t deleted = 0;
+	auto transaction (env.tx_begin_write ());
+	for (auto const & key : keys)
+	{
+		auto status (mdb_del (env.tx (transaction), handle, nano::store::lmdb::db_val (to_union (key)), nullptr));
+		release_assert (status == MDB_SUCCESS || status == MDB_NOTFOUND, mdb_strerror (status));
+		if (status == MDB_SUCCESS)
+		{
+			++deleted;
+		}
+	}
+	entries -= deleted;
+	return deleted;
+}
+
+void nano::unchecked_spill::clear ()
+{
+	auto transaction (env.tx_begin_write ());
+	auto status (mdb_drop (env.tx (transaction), handle, 0));
+	release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+	entries = 0;
+}
+
+uint64_t nano::unchecked_spill::size () const
+{
+	return entries;
+}
+
+nano::uint512_union nano::unchecked_spill::to_union (nano::unchecked_key const & key)
+{
+	return nano::uint512_union{ key.previous, key.hash };
+}
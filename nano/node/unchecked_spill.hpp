@@ -0,0 +1,59 @@
+#pragma once
+
+#include <nano/secure/common.hpp>
+#include <nano/store/lmdb/lmdb_env.hpp>
+
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Disk tier of the unchecked map, holds entries evicted from memory so they can still be satisfied instead of being dropped and requested again.
+ * Entries are kept in a dedicated LMDB environment, keyed by dependency followed by block hash, so all entries waiting on a dependency are adjacent.
+ * The environment is emptied when opened, spilled entries do not outlive the node process.
+ */
+class unchecked_spill final
+{
+public:
+	using action_t = std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)>;
+	using predicate_t = std::function<bool ()>;
+
+	unchecked_spill (std::filesystem::path const &, uint64_t max_entries);
+
+	bool init_error () const;
+
+	/**
+	 * Writes \p entries in a single transaction, entries past the disk budget are dropped
+	 * @return number of dropped entries
+	 */
+	std::size_t put (std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> const & entries);
+	void for_each (action_t const & action, predicate_t const & predicate) const;
+	void for_each (nano::hash_or_account const & dependency, action_t const & action, predicate_t const & predicate) const;
+	bool exists (nano::unchecked_key const &) const;
+	/**
+	 * Deletes \p keys in a single transaction
+	 * @return number of deleted entries
+	 */
+	std::size_t del (std::deque<nano::unchecked_key> const & keys);
+	void clear ();
+
+	uint64_t size () const;
+
+private:
+	void for_each_impl (nano::unchecked_key const & start, std::function<bool (nano::unchecked_key const &)> const & condition, action_t const & action, predicate_t const & predicate) const;
+
+	static nano::uint512_union to_union (nano::unchecked_key const &);
+
+private:
+	uint64_t const max_entries;
+	bool error{ false };
+	nano::store::lmdb::env env;
+	MDB_dbi handle{ 0 };
+	std::atomic<uint64_t> entries{ 0 };
+};
+}
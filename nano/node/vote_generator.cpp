@@ -35,6 +35,11 @@ nano::vote_generator::vote_generator (nano::node_config const & config_a, nano::
 	vote_generation_queue.process_batch = [this] (auto & batch) {
 		process_batch (batch);
 	};
+	if (config.vote_generator_threads > 0)
+	{
+		// Threads are only started once votes are signed for multiple representatives
+		signers = std::make_unique<nano::thread_pool> (config.vote_generator_threads, nano::thread_role::name::vote_signing);
+	}
 }
 
 nano::vote_generator::~vote_generator ()
@@ -96,6 +101,10 @@ void nano::vote_generator::stop ()
 	{
 		thread.join ();
 	}
+	if (signers)
+	{
+		signers->stop ();
+	}
 }
 
 void nano::vote_generator::add (const root & root, const block_hash & hash)
@@ -259,12 +268,13 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 void nano::vote_generator::vote (std::vector<nano::block_hash> const & hashes_a, std::vector<nano::root> const & roots_a, std::function<void (std::shared_ptr<nano::vote> const &)> const & action_a)
 {
 	debug_assert (hashes_a.size () == roots_a.size ());
-	std::vector<std::shared_ptr<nano::vote>> votes_l;
-	wallets.foreach_representative ([this, &hashes_a, &votes_l] (nano::public_key const & pub_a, nano::raw_key const & prv_a) {
-		auto timestamp = this->is_final ? nano::vote::timestamp_max : nano::milliseconds_since_epoch ();
-		uint8_t duration = this->is_final ? nano::vote::duration_max : /*8192ms*/ 0x9;
-		votes_l.emplace_back (std::make_shared<nano::vote> (pub_a, prv_a, timestamp, duration, hashes_a));
-	});
+	auto const start = std::chrono::steady_clock::now ();
+	auto votes_l = sign (hashes_a);
+	if (!votes_l.empty ())
+	{
+		auto const latency = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start);
+		stats.sample (is_final ? nano::stat::sample::vote_generator_final_latency : nano::stat::sample::vote_generator_latency, latency.count (), { 0, 1000 * 10 /* 0-10 milliseconds range */ });
+	}
 	for (auto const & vote_l : votes_l)
 	{
 		for (std::size_t i (0), n (hashes_a.size ()); i != n; ++i)
@@ -276,6 +286,87 @@ void nano::vote_generator::vote (std::vector<nano::block_hash> const & hashes_a,
 	}
 }
 
+std::vector<std::shared_ptr<nano::vote>> nano::vote_generator::sign (std::vector<nano::block_hash> const & hashes_a)
+{
+	std::vector<std::pair<nano::public_key, nano::raw_key>> representatives;
+	wallets.foreach_representative ([&representatives] (nano::public_key const & pub_a, nano::raw_key const & prv_a) {
+		representatives.emplace_back (pub_a, prv_a);
+	});
+
+	auto const timestamp = is_final ? nano::vote::timestamp_max : nano::milliseconds_since_epoch ();
+	uint8_t const duration = is_final ? nano::vote::duration_max : /*8192ms*/ 0x9;
+
+	std::vector<std::shared_ptr<nano::vote>> votes_l (representatives.size ());
+	auto sign_one = [&] (std::size_t index) {
+		auto const & [pub, prv] = representatives[index];
+		votes_l[index] = std::make_shared<nano::vote> (pub, prv, timestamp, duration, hashes_a);
+	};
+
+	if (!signers || representatives.size () < 2)
+	{
+		for (std::size_t i = 0; i < representatives.size (); ++i)
+		{
+			sign_one (i);
+		}
+		return votes_l;
+	}
+
+	// Only the voting thread signs votes, and it is joined before the pool is stopped
+	if (!signers->alive ())
+	{
+		signers->start ();
+	}
+
+	// Signer threads and the calling thread claim representatives until none are left
+	// The state is shared, so tasks that start after signing has finished (or never start because the pool was stopped) are harmless
+	struct job
+	{
+		std::function<void (std::size_t)> action;
+		std::size_t count;
+
+		std::atomic<std::size_t> next{ 0 };
+		std::size_t completed{ 0 };
+		nano::mutex mutex;
+		nano::condition_variable condition;
+
+		void run ()
+		{
+			std::size_t index;
+			while ((index = next.fetch_add (1)) < count)
+			{
+				action (index);
+				{
+					nano::lock_guard<nano::mutex> guard{ mutex };
+					++completed;
+				}
+				condition.notify_all ();
+			}
+		}
+	};
+
+	auto state = std::make_shared<job> ();
+	state->action = sign_one;
+	state->count = representatives.size ();
+
+	auto const tasks = std::min<std::size_t> (representatives.size () - 1, config.vote_generator_threads);
+	for (std::size_t i = 0; i < tasks; ++i)
+	{
+		signers->post ([state] () {
+			state->run ();
+		});
+	}
+
+	state->run ();
+
+	nano::unique_lock<nano::mutex> lock{ state->mutex };
+	state->condition.wait (lock, [&state] () {
+		return state->completed == state->count;
+	});
+
+	stats.add (nano::stat::type::vote_generator, nano::stat::detail::generator_signed_parallel, representatives.size ());
+	return votes_l;
+}
+
 void nano::vote_generator::broadcast_action (std::shared_ptr<nano::vote> const & vote_a) const
 {
 	network.flood_vote_pr (vote_a);
@@ -335,5 +426,9 @@ nano::container_info nano::vote_generator::container_info () const
 	info.put ("candidates", candidates.size ());
 	info.put ("requests", requests.size ());
 	info.add ("queue", vote_generation_queue.container_info ());
+	if (signers)
+	{
+		info.add ("signers", signers->container_info ());
+	}
 	return info;
 }
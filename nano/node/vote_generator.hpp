@@ -4,6 +4,7 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/processing_queue.hpp>
+#include <nano/lib/thread_pool.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/wallet.hpp>
@@ -53,6 +54,8 @@ private:
 	void broadcast (nano::unique_lock<nano::mutex> &);
 	void reply (nano::unique_lock<nano::mutex> &, request_t &&);
 	void vote (std::vector<nano::block_hash> const &, std::vector<nano::root> const &, std::function<void (std::shared_ptr<nano::vote> const &)> const &);
+	/** Creates and signs one vote per local representative, spreading the signing across the signer threads */
+	std::vector<std::shared_ptr<nano::vote>> sign (std::vector<nano::block_hash> const &);
 	void broadcast_action (std::shared_ptr<nano::vote> const &) const;
 	void process_batch (std::deque<queue_entry_t> & batch);
 	bool should_vote (transaction_variant_t const &, nano::root const &, nano::block_hash const &) const;
@@ -83,6 +86,7 @@ private:
 	std::deque<candidate_t> candidates;
 	std::atomic<bool> stopped{ false };
 	std::thread thread;
+	std::unique_ptr<nano::thread_pool> signers;
 	std::shared_ptr<nano::transport::channel> inproc_channel;
 };
 }
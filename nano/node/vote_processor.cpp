@@ -6,6 +6,7 @@
 #include <nano/node/online_reps.hpp>
 #include <nano/node/rep_tiers.hpp>
 #include <nano/node/repcrawler.hpp>
+#include <nano/node/signature_checker.hpp>
 #include <nano/node/vote_processor.hpp>
 #include <nano/node/vote_router.hpp>
 #include <nano/secure/common.hpp>
@@ -20,9 +21,10 @@ using namespace std::chrono_literals;
  * vote_processor
  */
 
-nano::vote_processor::vote_processor (vote_processor_config const & config_a, nano::vote_router & vote_router, nano::node_observers & observers_a, nano::stats & stats_a, nano::node_flags & flags_a, nano::logger & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a, nano::rep_tiers & rep_tiers_a) :
+nano::vote_processor::vote_processor (vote_processor_config const & config_a, nano::vote_router & vote_router, nano::signature_checker & signature_checker_a, nano::node_observers & observers_a, nano::stats & stats_a, nano::node_flags & flags_a, nano::logger & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a, nano::rep_tiers & rep_tiers_a) :
 	config{ config_a },
 	vote_router{ vote_router },
+	signature_checker{ signature_checker_a },
 	observers{ observers_a },
 	stats{ stats_a },
 	logger{ logger_a },
@@ -107,17 +109,20 @@ bool nano::vote_processor::vote (std::shared_ptr<nano::vote> const & vote, std::
 
 	auto const tier = rep_tiers.tier (vote->account);
 
-	bool added = false;
-	{
-		nano::lock_guard<nano::mutex> guard{ mutex };
-		added = queue.push ({ vote, source }, { tier, channel });
-	}
+	bool added = queue.push ({ vote, source }, { tier, channel });
 	if (added)
 	{
 		stats.inc (nano::stat::type::vote_processor, nano::stat::detail::process);
 		stats.inc (nano::stat::type::vote_processor_tier, to_stat_detail (tier));
 
-		condition.notify_one ();
+		if (sleeping > 0)
+		{
+			{
+				// Ensures a thread that just found the queue empty is already waiting on the condition
+				nano::lock_guard<nano::mutex> guard{ mutex };
+			}
+			condition.notify_one ();
+		}
 	}
 	else
 	{
@@ -142,7 +147,9 @@ void nano::vote_processor::run ()
 		}
 		else
 		{
+			++sleeping;
 			condition.wait (lock, [&] { return stopped || !queue.empty (); });
+			--sleeping;
 		}
 	}
 }
@@ -151,20 +158,46 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
+
+	lock.unlock ();
 
 	nano::timer<std::chrono::milliseconds> timer;
 	timer.start ();
 
+	// The queue is shared with other processing threads, the batch might be smaller than expected or even empty
 	auto batch = queue.next_batch (config.batch_size);
 
-	lock.unlock ();
+	// Verify signatures of the whole batch at once, this is significantly cheaper than verifying each vote individually
+	std::vector<std::shared_ptr<nano::vote>> votes;
+	votes.reserve (batch.size ());
+	for (auto const & [item, origin] : batch)
+	{
+		votes.push_back (item.first);
+	}
+	auto const invalid = signature_checker.verify (votes);
 
+	// Route all valid votes in a single pass
+	nano::vote_router::batch_t valid;
+	valid.reserve (batch.size ());
+	std::size_t index = 0;
+	for (auto const & [item, origin] : batch)
+	{
+		if (!invalid[index++])
+		{
+			valid.push_back (item);
+		}
+	}
+	auto const results = vote_router.vote (valid);
+
+	index = 0;
+	std::size_t valid_index = 0;
 	for (auto const & [item, origin] : batch)
 	{
 		auto const & [vote, source] = item;
-		vote_blocking (vote, origin.channel, source);
+		auto const result = invalid[index++] ? nano::vote_code::invalid : aggregate (results[valid_index++]);
+		processed (vote, origin.channel, source, result);
 	}
+	debug_assert (valid_index == results.size ());
 
 	total_processed += batch.size ();
 
@@ -179,21 +212,27 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 
 nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source)
 {
-	auto result = nano::vote_code::invalid;
-	if (!vote->validate ()) // false => valid vote
-	{
-		auto vote_results = vote_router.vote (vote, source);
+	auto const result = vote->validate () ? nano::vote_code::invalid : aggregate (vote_router.vote (vote, source));
+	return processed (vote, channel, source, result);
+}
 
-		// Aggregate results for individual hashes
-		bool replay = false;
-		bool processed = false;
-		for (auto const & [hash, hash_result] : vote_results)
-		{
-			replay |= (hash_result == nano::vote_code::replay);
-			processed |= (hash_result == nano::vote_code::vote);
-		}
-		result = replay ? nano::vote_code::replay : (processed ? nano::vote_code::vote : nano::vote_code::indeterminate);
+// Aggregate results for individual hashes
+nano::vote_code nano::vote_processor::aggregate (std::unordered_map<nano::block_hash, nano::vote_code> const & vote_results)
+{
+	bool replay = false;
+	bool processed = false;
+	for (auto const & [hash, hash_result] : vote_results)
+	{
+		replay |= (hash_result == nano::vote_code::replay);
+		processed |= (hash_result == nano::vote_code::vote);
+	}
+	return replay ? nano::vote_code::replay : (processed ? nano::vote_code::vote : nano::vote_code::indeterminate);
+}
 
+nano::vote_code nano::vote_processor::processed (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source, nano::vote_code result)
+{
+	if (result != nano::vote_code::invalid)
+	{
 		observers.vote.notify (vote, channel, source, result);
 	}
 
@@ -209,20 +248,16 @@ nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote>
 
 std::size_t nano::vote_processor::size () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
 	return queue.size ();
 }
 
 bool nano::vote_processor::empty () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
 	return queue.empty ();
 }
 
 nano::container_info nano::vote_processor::container_info () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-
 	nano::container_info info;
 	info.put ("votes", queue.size ());
 	info.add ("queue", queue.container_info ());
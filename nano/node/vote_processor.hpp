@@ -3,7 +3,7 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
-#include <nano/node/fair_queue.hpp>
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/rep_tiers.hpp>
 #include <nano/node/vote_router.hpp>
@@ -28,7 +28,7 @@ public:
 	size_t max_pr_queue{ 256 };
 	size_t max_non_pr_queue{ 32 };
 	size_t pr_priority{ 3 };
-	size_t threads{ std::clamp (nano::hardware_concurrency () / 2, 1u, 4u) };
+	size_t threads{ std::clamp (nano::hardware_concurrency () / 2, 1u, 16u) };
 	size_t batch_size{ 1024 };
 	size_t max_triggered{ 16384 };
 };
@@ -36,7 +36,7 @@ public:
 class vote_processor final
 {
 public:
-	vote_processor (vote_processor_config const &, nano::vote_router &, nano::node_observers &, nano::stats &, nano::node_flags &, nano::logger &, nano::online_reps &, nano::rep_crawler &, nano::ledger &, nano::network_params &, nano::rep_tiers &);
+	vote_processor (vote_processor_config const &, nano::vote_router &, nano::signature_checker &, nano::node_observers &, nano::stats &, nano::node_flags &, nano::logger &, nano::online_reps &, nano::rep_crawler &, nano::ledger &, nano::network_params &, nano::rep_tiers &);
 	~vote_processor ();
 
 	void start ();
@@ -59,6 +59,7 @@ public:
 private: // Dependencies
 	vote_processor_config const & config;
 	nano::vote_router & vote_router;
+	nano::signature_checker & signature_checker;
 	nano::node_observers & observers;
 	nano::stats & stats;
 	nano::logger & logger;
@@ -71,13 +72,17 @@ private: // Dependencies
 private:
 	void run ();
 	void run_batch (nano::unique_lock<nano::mutex> &);
+	nano::vote_code processed (std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> const &, nano::vote_source, nano::vote_code);
+	static nano::vote_code aggregate (std::unordered_map<nano::block_hash, nano::vote_code> const &);
 
 private:
 	using entry_t = std::pair<std::shared_ptr<nano::vote>, nano::vote_source>;
-	nano::fair_queue<entry_t, nano::rep_tier> queue;
+	nano::concurrent_fair_queue<entry_t, nano::rep_tier> queue;
 
 private:
 	bool stopped{ false };
+	// Number of threads waiting for votes, producers only need to synchronize with the mutex when some thread might be sleeping
+	std::atomic<size_t> sleeping{ 0 };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::vote_processor) };
 	std::vector<std::thread> threads;
@@ -35,23 +35,26 @@ nano::vote_router::~vote_router ()
 
 void nano::vote_router::connect (nano::block_hash const & hash, std::weak_ptr<nano::election> election)
 {
-	std::unique_lock lock{ mutex };
-	elections.insert_or_assign (hash, election);
+	auto & shard = shard_for (hash);
+	std::unique_lock lock{ shard.mutex };
+	shard.elections.insert_or_assign (hash, election);
 }
 
 void nano::vote_router::disconnect (nano::election const & election)
 {
-	std::unique_lock lock{ mutex };
 	for (auto const & [hash, _] : election.blocks ())
 	{
-		elections.erase (hash);
+		auto & shard = shard_for (hash);
+		std::unique_lock lock{ shard.mutex };
+		shard.elections.erase (hash);
 	}
 }
 
 void nano::vote_router::disconnect (nano::block_hash const & hash)
 {
-	std::unique_lock lock{ mutex };
-	[[maybe_unused]] auto erased = elections.erase (hash);
+	auto & shard = shard_for (hash);
+	std::unique_lock lock{ shard.mutex };
+	[[maybe_unused]] auto erased = shard.elections.erase (hash);
 	debug_assert (erased == 1);
 }
 
@@ -64,46 +67,93 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 		return hash == filter;
 	}));
 
-	std::unordered_map<nano::block_hash, nano::vote_code> results;
-	std::unordered_map<nano::block_hash, std::shared_ptr<nano::election>> process;
+	auto const elections = filter.is_zero () ? find_elections (vote->hashes) : find_elections ({ filter });
+	return apply (vote, source, filter, elections);
+}
+
+std::vector<std::unordered_map<nano::block_hash, nano::vote_code>> nano::vote_router::vote (batch_t const & batch)
+{
+	std::vector<nano::block_hash> hashes;
+	for (auto const & [vote, source] : batch)
+	{
+		debug_assert (!vote->validate ()); // false => valid vote
+		hashes.insert (hashes.end (), vote->hashes.begin (), vote->hashes.end ());
+	}
+
+	auto const elections = find_elections (hashes);
+
+	std::vector<std::unordered_map<nano::block_hash, nano::vote_code>> results;
+	results.reserve (batch.size ());
+	for (auto const & [vote, source] : batch)
+	{
+		results.push_back (apply (vote, source, { 0 }, elections));
+	}
+	return results;
+}
+
+auto nano::vote_router::find_elections (std::vector<nano::block_hash> const & hashes) const -> elections_t
+{
+	// Group hashes by shard so that each shard lock is taken at most once
+	std::array<std::vector<nano::block_hash const *>, shard_count> grouped;
+	for (auto const & hash : hashes)
 	{
-		std::shared_lock lock{ mutex };
-		for (auto const & hash : vote->hashes)
+		grouped[shard_index (hash)].push_back (&hash);
+	}
+
+	elections_t result;
+	for (std::size_t index = 0; index < shard_count; ++index)
+	{
+		if (grouped[index].empty ())
+		{
+			continue;
+		}
+		auto const & shard = shards[index];
+		std::shared_lock lock{ shard.mutex };
+		for (auto const * hash : grouped[index])
 		{
-			// Ignore votes for other hashes if a filter is set
-			if (!filter.is_zero () && hash != filter)
+			if (auto existing = shard.elections.find (*hash); existing != shard.elections.end ())
 			{
-				continue;
+				if (auto election = existing->second.lock ())
+				{
+					result.emplace (*hash, std::move (election));
+				}
 			}
+		}
+	}
+	return result;
+}
 
-			// Ignore duplicate hashes (should not happen with a well-behaved voting node)
-			if (results.find (hash) != results.end ())
-			{
-				continue;
-			}
+std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::apply (std::shared_ptr<nano::vote> const & vote, nano::vote_source source, nano::block_hash const & filter, elections_t const & elections)
+{
+	std::unordered_map<nano::block_hash, nano::vote_code> results;
+	std::unordered_map<nano::block_hash, std::shared_ptr<nano::election>> process;
+	for (auto const & hash : vote->hashes)
+	{
+		// Ignore votes for other hashes if a filter is set
+		if (!filter.is_zero () && hash != filter)
+		{
+			continue;
+		}
 
-			auto find_election = [this] (auto const & hash) -> std::shared_ptr<nano::election> {
-				if (auto existing = elections.find (hash); existing != elections.end ())
-				{
-					return existing->second.lock ();
-				}
-				return {};
-			};
+		// Ignore duplicate hashes (should not happen with a well-behaved voting node)
+		if (results.find (hash) != results.end () || process.find (hash) != process.end ())
+		{
+			continue;
+		}
 
-			if (auto election = find_election (hash))
+		if (auto existing = elections.find (hash); existing != elections.end ())
+		{
+			process[hash] = existing->second;
+		}
+		else
+		{
+			if (!recently_confirmed.exists (hash))
 			{
-				process[hash] = election;
+				results[hash] = nano::vote_code::indeterminate;
 			}
 			else
 			{
-				if (!recently_confirmed.exists (hash))
-				{
-					results[hash] = nano::vote_code::indeterminate;
-				}
-				else
-				{
-					results[hash] = nano::vote_code::replay;
-				}
+				results[hash] = nano::vote_code::replay;
 			}
 		}
 	}
@@ -132,8 +182,9 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 
 bool nano::vote_router::active (nano::block_hash const & hash) const
 {
-	std::shared_lock lock{ mutex };
-	if (auto existing = elections.find (hash); existing != elections.end ())
+	auto const & shard = shard_for (hash);
+	std::shared_lock lock{ shard.mutex };
+	if (auto existing = shard.elections.find (hash); existing != shard.elections.end ())
 	{
 		if (auto election = existing->second.lock (); election != nullptr)
 		{
@@ -145,8 +196,9 @@ bool nano::vote_router::active (nano::block_hash const & hash) const
 
 std::shared_ptr<nano::election> nano::vote_router::election (nano::block_hash const & hash) const
 {
-	std::shared_lock lock{ mutex };
-	if (auto existing = elections.find (hash); existing != elections.end ())
+	auto const & shard = shard_for (hash);
+	std::shared_lock lock{ shard.mutex };
+	if (auto existing = shard.elections.find (hash); existing != shard.elections.end ())
 	{
 		if (auto election = existing->second.lock (); election != nullptr)
 		{
@@ -159,8 +211,25 @@ std::shared_ptr<nano::election> nano::vote_router::election (nano::block_hash co
 // This is meant to be a fast check and may return false positives if weak pointers have expired, but we don't care about that here
 bool nano::vote_router::contains (nano::block_hash const & hash) const
 {
-	std::shared_lock lock{ mutex };
-	return elections.contains (hash);
+	auto const & shard = shard_for (hash);
+	std::shared_lock lock{ shard.mutex };
+	return shard.elections.contains (hash);
+}
+
+std::size_t nano::vote_router::shard_index (nano::block_hash const & hash)
+{
+	// Block hashes are uniformly distributed, so any part of the hash is a good shard selector
+	return hash.qwords[0] % shard_count;
+}
+
+auto nano::vote_router::shard_for (nano::block_hash const & hash) -> shard &
+{
+	return shards[shard_index (hash)];
+}
+
+auto nano::vote_router::shard_for (nano::block_hash const & hash) const -> shard const &
+{
+	return shards[shard_index (hash)];
 }
 
 void nano::vote_router::start ()
@@ -173,9 +242,10 @@ void nano::vote_router::start ()
 
 void nano::vote_router::stop ()
 {
-	std::unique_lock lock{ mutex };
-	stopped = true;
-	lock.unlock ();
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		stopped = true;
+	}
 	condition.notify_all ();
 	if (thread.joinable ())
 	{
@@ -185,19 +255,35 @@ void nano::vote_router::stop ()
 
 void nano::vote_router::run ()
 {
-	std::unique_lock lock{ mutex };
+	nano::unique_lock<nano::mutex> lock{ mutex };
 	while (!stopped)
 	{
-		std::erase_if (elections, [] (auto const & pair) { return pair.second.lock () == nullptr; });
+		lock.unlock ();
+		cleanup ();
+		lock.lock ();
 		condition.wait_for (lock, 15s, [&] () { return stopped; });
 	}
 }
 
+void nano::vote_router::cleanup ()
+{
+	for (auto & shard : shards)
+	{
+		std::unique_lock lock{ shard.mutex };
+		std::erase_if (shard.elections, [] (auto const & pair) { return pair.second.lock () == nullptr; });
+	}
+}
+
 nano::container_info nano::vote_router::container_info () const
 {
-	std::shared_lock lock{ mutex };
+	std::size_t total = 0;
+	for (auto const & shard : shards)
+	{
+		std::shared_lock lock{ shard.mutex };
+		total += shard.elections.size ();
+	}
 
 	nano::container_info info;
-	info.put ("elections", elections);
+	info.put<std::pair<nano::block_hash, std::weak_ptr<nano::election>>> ("elections", total);
 	return info;
 }
@@ -2,12 +2,15 @@
 
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/numbers_templ.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/node/fwd.hpp>
 
+#include <array>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace nano
 {
@@ -34,6 +37,7 @@ nano::stat::detail to_stat_detail (vote_source);
 // This class routes votes to their associated election
 // This class holds a weak_ptr as this container does not own the elections
 // Routing entries are removed periodically if the weak_ptr has expired
+// Routes are sharded by block hash so that concurrent vote processing threads rarely contend on the same lock
 class vote_router final
 {
 public:
@@ -56,6 +60,10 @@ public:
 	// If 'filter' parameter is non-zero, only elections for the specified hash are notified.
 	// This eliminates duplicate processing when triggering votes from the vote_cache as the result of a specific election being created.
 	std::unordered_map<nano::block_hash, nano::vote_code> vote (std::shared_ptr<nano::vote> const &, nano::vote_source = nano::vote_source::live, nano::block_hash filter = { 0 });
+	// Route a batch of votes, elections for all hashes in the batch are looked up in a single pass taking each shard lock at most once
+	// Returns per vote results in the same order as the input
+	using batch_t = std::vector<std::pair<std::shared_ptr<nano::vote>, nano::vote_source>>;
+	std::vector<std::unordered_map<nano::block_hash, nano::vote_code>> vote (batch_t const &);
 	bool active (nano::block_hash const & hash) const;
 	std::shared_ptr<nano::election> election (nano::block_hash const & hash) const;
 	bool contains (nano::block_hash const & hash) const;
@@ -70,16 +78,34 @@ private: // Dependencies
 	nano::recently_confirmed_cache & recently_confirmed;
 
 private:
+	using elections_t = std::unordered_map<nano::block_hash, std::shared_ptr<nano::election>>;
+
 	void run ();
+	void cleanup ();
+	// Looks up live elections for the given hashes, grouping lookups by shard
+	elections_t find_elections (std::vector<nano::block_hash> const & hashes) const;
+	std::unordered_map<nano::block_hash, nano::vote_code> apply (std::shared_ptr<nano::vote> const &, nano::vote_source, nano::block_hash const & filter, elections_t const &);
 
 private:
-	// Mapping of block hashes to elections.
-	// Election already contains the associated block
-	std::unordered_map<nano::block_hash, std::weak_ptr<nano::election>> elections;
+	static std::size_t constexpr shard_count = 16;
+
+	struct alignas (64) shard
+	{
+		// Mapping of block hashes to elections.
+		// Election already contains the associated block
+		std::unordered_map<nano::block_hash, std::weak_ptr<nano::election>> elections;
+		mutable std::shared_mutex mutex;
+	};
+
+	static std::size_t shard_index (nano::block_hash const &);
+	shard & shard_for (nano::block_hash const &);
+	shard const & shard_for (nano::block_hash const &) const;
+
+	std::array<shard, shard_count> shards;
 
 	bool stopped{ false };
-	std::condition_variable_any condition;
-	mutable std::shared_mutex mutex;
+	nano::condition_variable condition;
+	mutable nano::mutex mutex;
 	std::thread thread;
 };
 }
@@ -1,12 +1,15 @@
 #include <nano/boost/asio/bind_executor.hpp>
 #include <nano/boost/asio/dispatch.hpp>
 #include <nano/boost/asio/strand.hpp>
+#include <nano/ipc_flatbuffers_lib/flatbuffer_producer.hpp>
 #include <nano/lib/block_type.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/jsonconfig.hpp>
 #include <nano/lib/logging.hpp>
+#include <nano/lib/stats.hpp>
 #include <nano/lib/work.hpp>
 #include <nano/node/election_status.hpp>
+#include <nano/node/ipc/flatbuffers_util.hpp>
 #include <nano/node/node_observers.hpp>
 #include <nano/node/transport/channel.hpp>
 #include <nano/node/vote_router.hpp>
@@ -82,8 +85,7 @@ nano::websocket::confirmation_options::confirmation_options (boost::property_tre
 			nano::account result_l{};
 			if (!result_l.decode_account (account_l.second.data ()))
 			{
-				// Do not insert the given raw data to keep old prefix support
-				accounts.insert (result_l.to_account ());
+				accounts.insert (result_l);
 			}
 			else
 			{
@@ -122,22 +124,22 @@ bool nano::websocket::confirmation_options::should_filter (nano::websocket::mess
 	if (destination_opt_l)
 	{
 		auto source_text_l (message_a.contents.get<std::string> ("message.account"));
+		nano::account source_l{};
+		nano::account destination_l{};
+		auto decode_source_ok_l (!source_l.decode_account (source_text_l));
+		auto decode_destination_ok_l (!destination_l.decode_account (destination_opt_l.get ()));
+		(void)decode_source_ok_l;
+		(void)decode_destination_ok_l;
+		debug_assert (decode_source_ok_l && decode_destination_ok_l);
 		if (all_local_accounts)
 		{
 			auto transaction_l (wallets.tx_begin_read ());
-			nano::account source_l{};
-			nano::account destination_l{};
-			auto decode_source_ok_l (!source_l.decode_account (source_text_l));
-			auto decode_destination_ok_l (!destination_l.decode_account (destination_opt_l.get ()));
-			(void)decode_source_ok_l;
-			(void)decode_destination_ok_l;
-			debug_assert (decode_source_ok_l && decode_destination_ok_l);
 			if (wallets.exists (transaction_l, source_l) || wallets.exists (transaction_l, destination_l))
 			{
 				should_filter_account = false;
 			}
 		}
-		if (accounts.find (source_text_l) != accounts.end () || accounts.find (destination_opt_l.get ()) != accounts.end ())
+		if (accounts.find (source_l) != accounts.end () || accounts.find (destination_l) != accounts.end ())
 		{
 			should_filter_account = false;
 		}
@@ -155,15 +157,13 @@ bool nano::websocket::confirmation_options::update (boost::property_tree::ptree
 			nano::account result_l{};
 			if (!result_l.decode_account (account_l.second.data ()))
 			{
-				// Re-encode to keep old prefix support
-				auto encoded_l (result_l.to_account ());
 				if (insert_a)
 				{
-					this->accounts.insert (encoded_l);
+					this->accounts.insert (result_l);
 				}
 				else
 				{
-					this->accounts.erase (encoded_l);
+					this->accounts.erase (result_l);
 				}
 			}
 			else
@@ -271,6 +271,7 @@ nano::websocket::session::session (nano::websocket::listener & listener_a, socke
 
 nano::websocket::session::~session ()
 {
+	ws_listener.confirmation_subscriptions.erase (*this);
 	{
 		nano::unique_lock<nano::mutex> lk (subscriptions_mutex);
 		for (auto & subscription : subscriptions)
@@ -313,31 +314,74 @@ void nano::websocket::session::close ()
 
 void nano::websocket::session::write (nano::websocket::message message_a)
 {
-	nano::unique_lock<nano::mutex> lk (subscriptions_mutex);
-	auto subscription (subscriptions.find (message_a.topic));
-	if (message_a.topic == nano::websocket::topic::ack || (subscription != subscriptions.end () && !subscription->second->should_filter (message_a)))
+	if (accepts (message_a))
 	{
-		lk.unlock ();
-		auto this_l (shared_from_this ());
-		boost::asio::post (ws.get_strand (),
-		[message_a, this_l] () {
-			bool write_in_progress = !this_l->send_queue.empty ();
-			this_l->send_queue.emplace_back (message_a);
-			if (!write_in_progress)
+		if (message_a.flatbuffers && encoding (message_a.topic) == nano::websocket::encoding::flatbuffers)
+		{
+			queue (message_a.topic, message_a.flatbuffers (), true);
+		}
+		else
+		{
+			queue (message_a.topic, nano::shared_const_buffer{ message_a.to_string () });
+		}
+	}
+}
+
+bool nano::websocket::session::accepts (nano::websocket::message const & message_a)
+{
+	nano::lock_guard<nano::mutex> lk (subscriptions_mutex);
+	auto subscription (subscriptions.find (message_a.topic));
+	return message_a.topic == nano::websocket::topic::ack || (subscription != subscriptions.end () && !subscription->second->should_filter (message_a));
+}
+
+nano::websocket::encoding nano::websocket::session::encoding (nano::websocket::topic topic_a)
+{
+	nano::lock_guard<nano::mutex> lk (subscriptions_mutex);
+	auto subscription (subscriptions.find (topic_a));
+	return subscription != subscriptions.end () ? subscription->second->get_encoding () : nano::websocket::encoding::json;
+}
+
+void nano::websocket::session::queue (nano::websocket::topic topic_a, nano::shared_const_buffer const & payload_a, bool binary_a)
+{
+	auto this_l (shared_from_this ());
+	boost::asio::post (ws.get_strand (),
+	[topic_a, payload_a, binary_a, this_l] () {
+		auto & send_queue = this_l->send_queue;
+		if (send_queue.size () >= std::max<std::size_t> (this_l->ws_listener.config.max_queued_messages, 1))
+		{
+			// The front message is being written, drop the oldest message waiting behind it
+			if (send_queue.size () > 1)
 			{
-				this_l->write_queued_messages ();
+				auto oldest = std::next (send_queue.begin ());
+				this_l->ws_listener.stats.inc (nano::stat::type::websocket_drop, nano::websocket::to_stat_detail (oldest->topic));
+				send_queue.erase (oldest);
 			}
-		});
-	}
+			else
+			{
+				this_l->ws_listener.stats.inc (nano::stat::type::websocket_drop, nano::websocket::to_stat_detail (topic_a));
+				return;
+			}
+		}
+		bool write_in_progress = !send_queue.empty ();
+		send_queue.push_back ({ topic_a, payload_a, binary_a });
+		if (!write_in_progress)
+		{
+			this_l->write_queued_messages ();
+		}
+	});
 }
 
 void nano::websocket::session::write_queued_messages ()
 {
-	auto msg (send_queue.front ().to_string ());
+	auto const & front = send_queue.front ();
 	auto this_l (shared_from_this ());
 
-	ws.async_write (nano::shared_const_buffer (msg),
+	ws.binary (front.binary);
+	ws.async_write (front.payload,
 	[this_l] (boost::system::error_code ec, std::size_t bytes_transferred) {
+		auto const & written = this_l->send_queue.front ();
+		this_l->ws_listener.stats.inc (nano::stat::type::websocket_send, nano::websocket::to_stat_detail (written.topic));
+		this_l->ws_listener.stats.add (nano::stat::type::websocket_send_bytes, nano::websocket::to_stat_detail (written.topic), bytes_transferred);
 		this_l->send_queue.pop_front ();
 		if (!ec)
 		{
@@ -387,6 +431,28 @@ void nano::websocket::session::read ()
 
 namespace
 {
+/** Maps the election status to one of the confirmation_options type_ flags, 0 if the type can't be subscribed to */
+uint8_t to_confirmation_type (nano::election_status_type type_a)
+{
+	switch (type_a)
+	{
+		case nano::election_status_type::active_confirmed_quorum:
+			return nano::websocket::confirmation_options::type_active_quorum;
+		case nano::election_status_type::active_confirmation_height:
+			return nano::websocket::confirmation_options::type_active_confirmation_height;
+		case nano::election_status_type::inactive_confirmation_height:
+			return nano::websocket::confirmation_options::type_inactive;
+		default:
+			return 0;
+	}
+}
+
+/** Index of the combination of options that change the contents of a confirmation message */
+std::size_t content_options_index (nano::websocket::confirmation_options const & options_a)
+{
+	return (options_a.get_include_block () ? 1 : 0) | (options_a.get_include_election_info () ? 2 : 0) | (options_a.get_include_election_info_with_votes () ? 4 : 0) | (options_a.get_include_sideband_info () ? 8 : 0);
+}
+
 nano::websocket::topic to_topic (std::string const & topic_a)
 {
 	nano::websocket::topic topic = nano::websocket::topic::invalid;
@@ -472,6 +538,28 @@ std::string from_topic (nano::websocket::topic topic_a)
 
 	return topic;
 }
+
+/** Parses the encoding requested for a subscription to \p topic_a, empty if the encoding is unknown or not supported by the topic */
+std::optional<nano::websocket::encoding> to_encoding (std::string const & encoding_a, nano::websocket::topic topic_a)
+{
+	if (encoding_a == "json")
+	{
+		return nano::websocket::encoding::json;
+	}
+	if (encoding_a == "flatbuffers" && nano::websocket::supports_flatbuffers (topic_a))
+	{
+		return nano::websocket::encoding::flatbuffers;
+	}
+	return std::nullopt;
+}
+
+/** Wraps \p object_a in an envelope and copies the finished flatbuffer into a buffer which can be shared between sessions */
+template <typename T>
+nano::shared_const_buffer to_flatbuffers (T & object_a)
+{
+	auto fbb (nano::ipc::flatbuffer_producer::make_buffer (object_a));
+	return nano::shared_const_buffer{ std::vector<uint8_t> (fbb->GetBufferPointer (), fbb->GetBufferPointer () + fbb->GetSize ()) };
+}
 }
 
 void nano::websocket::session::send_ack (std::string action_a, std::string id_a)
@@ -494,7 +582,12 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 	auto ack_l (message_a.get<bool> ("ack", false));
 	auto id_l (message_a.get<std::string> ("id", ""));
 	auto action_succeeded (false);
-	if (action == "subscribe" && topic_l != nano::websocket::topic::invalid)
+	auto encoding_l (to_encoding (message_a.get<std::string> ("encoding", "json"), topic_l));
+	if (action == "subscribe" && topic_l != nano::websocket::topic::invalid && !encoding_l)
+	{
+		logger.warn (nano::log::type::websocket, "Unsupported encoding for topic: {} ({})", from_topic (topic_l), nano::util::to_str (remote));
+	}
+	else if (action == "subscribe" && topic_l != nano::websocket::topic::invalid)
 	{
 		auto options_text_l (message_a.get_child_optional ("options"));
 		nano::lock_guard<nano::mutex> lk (subscriptions_mutex);
@@ -511,6 +604,7 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 		{
 			options_l = std::make_unique<nano::websocket::options> ();
 		}
+		options_l->encoding = *encoding_l;
 		auto existing (subscriptions.find (topic_l));
 		if (existing != subscriptions.end ())
 		{
@@ -525,6 +619,10 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 			subscriptions.emplace (topic_l, std::move (options_l));
 			ws_listener.increase_subscriber_count (topic_l);
 		}
+		if (topic_l == nano::websocket::topic::confirmation)
+		{
+			ws_listener.confirmation_subscriptions.update (*this, dynamic_cast<nano::websocket::confirmation_options *> (subscriptions[topic_l].get ()));
+		}
 		action_succeeded = true;
 	}
 	else if (action == "update")
@@ -536,6 +634,10 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 			auto options_text_l (message_a.get_child_optional ("options"));
 			if (options_text_l.is_initialized () && !existing->second->update (*options_text_l))
 			{
+				if (topic_l == nano::websocket::topic::confirmation)
+				{
+					ws_listener.confirmation_subscriptions.update (*this, dynamic_cast<nano::websocket::confirmation_options *> (existing->second.get ()));
+				}
 				action_succeeded = true;
 			}
 		}
@@ -547,6 +649,10 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 		{
 			logger.info (nano::log::type::websocket, "Removed subscription to topic: {} ({})", from_topic (topic_l), nano::util::to_str (remote));
 
+			if (topic_l == nano::websocket::topic::confirmation)
+			{
+				ws_listener.confirmation_subscriptions.erase (*this);
+			}
 			ws_listener.decrease_subscriber_count (topic_l);
 		}
 		action_succeeded = true;
@@ -563,6 +669,145 @@ void nano::websocket::session::handle_message (boost::property_tree::ptree const
 	}
 }
 
+nano::stat::detail nano::websocket::to_stat_detail (nano::websocket::topic topic)
+{
+	switch (topic)
+	{
+		case nano::websocket::topic::ack:
+			return nano::stat::detail::ack;
+		case nano::websocket::topic::confirmation:
+			return nano::stat::detail::confirmation;
+		case nano::websocket::topic::started_election:
+			return nano::stat::detail::started_election;
+		case nano::websocket::topic::stopped_election:
+			return nano::stat::detail::stopped_election;
+		case nano::websocket::topic::vote:
+			return nano::stat::detail::vote;
+		case nano::websocket::topic::work:
+			return nano::stat::detail::work;
+		case nano::websocket::topic::bootstrap:
+			return nano::stat::detail::bootstrap;
+		case nano::websocket::topic::telemetry:
+			return nano::stat::detail::telemetry;
+		case nano::websocket::topic::new_unconfirmed_block:
+			return nano::stat::detail::new_unconfirmed_block;
+		case nano::websocket::topic::invalid:
+		case nano::websocket::topic::_length:
+			break;
+	}
+	return nano::stat::detail::invalid;
+}
+
+bool nano::websocket::supports_flatbuffers (nano::websocket::topic topic_a)
+{
+	switch (topic_a)
+	{
+		case nano::websocket::topic::confirmation:
+		case nano::websocket::topic::started_election:
+		case nano::websocket::topic::stopped_election:
+		case nano::websocket::topic::vote:
+		case nano::websocket::topic::new_unconfirmed_block:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * confirmation_index
+ */
+
+void nano::websocket::confirmation_index::update (nano::websocket::session & session_a, nano::websocket::confirmation_options const * options_a)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	erase_impl (session_a);
+	if (options_a == nullptr || !options_a->get_has_account_filtering_options ())
+	{
+		unfiltered.insert (&session_a);
+		return;
+	}
+	if (options_a->get_all_local_accounts ())
+	{
+		local.insert (&session_a);
+	}
+	auto & indexed = session_accounts[&session_a];
+	for (auto const & account : options_a->get_accounts ())
+	{
+		accounts[account].insert (&session_a);
+		indexed.push_back (account);
+	}
+}
+
+void nano::websocket::confirmation_index::erase (nano::websocket::session & session_a)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	erase_impl (session_a);
+}
+
+void nano::websocket::confirmation_index::erase_impl (nano::websocket::session & session_a)
+{
+	unfiltered.erase (&session_a);
+	local.erase (&session_a);
+	if (auto existing = session_accounts.find (&session_a); existing != session_accounts.end ())
+	{
+		for (auto const & account : existing->second)
+		{
+			auto entry = accounts.find (account);
+			debug_assert (entry != accounts.end ());
+			entry->second.erase (&session_a);
+			if (entry->second.empty ())
+			{
+				accounts.erase (entry);
+			}
+		}
+		session_accounts.erase (existing);
+	}
+}
+
+std::vector<std::shared_ptr<nano::websocket::session>> nano::websocket::confirmation_index::find (nano::account const & account_a, std::optional<nano::account> const & destination_a, std::function<bool ()> const & is_local_a) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+
+	std::vector<nano::websocket::session *> matches (unfiltered.begin (), unfiltered.end ());
+	if (destination_a)
+	{
+		auto const filtered_begin = matches.size ();
+		for (auto const & account : { account_a, *destination_a })
+		{
+			if (auto entry = accounts.find (account); entry != accounts.end ())
+			{
+				matches.insert (matches.end (), entry->second.begin (), entry->second.end ());
+			}
+		}
+		if (!local.empty () && is_local_a ())
+		{
+			matches.insert (matches.end (), local.begin (), local.end ());
+		}
+		// A session can match on both accounts and on local accounts
+		std::sort (matches.begin () + filtered_begin, matches.end ());
+		matches.erase (std::unique (matches.begin () + filtered_begin, matches.end ()), matches.end ());
+	}
+
+	std::vector<std::shared_ptr<nano::websocket::session>> result;
+	result.reserve (matches.size ());
+	for (auto session : matches)
+	{
+		// Sessions being destroyed can't be locked anymore, they are removed from the index by their destructor
+		if (auto session_l = session->weak_from_this ().lock ())
+		{
+			result.push_back (std::move (session_l));
+		}
+	}
+	return result;
+}
+
+std::size_t nano::websocket::confirmation_index::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	// Every session with account filtering has an entry in session_accounts, even if it only filters on local accounts
+	return unfiltered.size () + session_accounts.size ();
+}
+
 void nano::websocket::listener::stop ()
 {
 	stopped = true;
@@ -580,7 +825,9 @@ void nano::websocket::listener::stop ()
 	sessions.clear ();
 }
 
-nano::websocket::listener::listener (nano::logger & logger_a, nano::wallets & wallets_a, boost::asio::io_context & io_ctx_a, boost::asio::ip::tcp::endpoint endpoint_a) :
+nano::websocket::listener::listener (nano::websocket::config const & config_a, nano::stats & stats_a, nano::logger & logger_a, nano::wallets & wallets_a, boost::asio::io_context & io_ctx_a, boost::asio::ip::tcp::endpoint endpoint_a) :
+	config (config_a),
+	stats (stats_a),
 	logger (logger_a),
 	wallets (wallets_a),
 	acceptor (io_ctx_a),
@@ -652,49 +899,84 @@ void nano::websocket::listener::broadcast_confirmation (std::shared_ptr<nano::bl
 {
 	nano::websocket::message_builder builder;
 
-	nano::lock_guard<nano::mutex> lk (sessions_mutex);
-	boost::optional<nano::websocket::message> msg_with_block;
-	boost::optional<nano::websocket::message> msg_without_block;
-	for (auto & weak_session : sessions)
+	// Account filters match the source and destination of state blocks
+	std::optional<nano::account> destination_l;
+	if (block_a->type () == nano::block_type::state)
 	{
-		auto session_ptr (weak_session.lock ());
-		if (session_ptr)
-		{
-			auto subscription (session_ptr->subscriptions.find (nano::websocket::topic::confirmation));
-			if (subscription != session_ptr->subscriptions.end ())
-			{
-				nano::websocket::confirmation_options default_options (wallets, logger);
-				auto conf_options (dynamic_cast<nano::websocket::confirmation_options *> (subscription->second.get ()));
-				if (conf_options == nullptr)
-				{
-					conf_options = &default_options;
-				}
-				auto include_block (conf_options == nullptr ? true : conf_options->get_include_block ());
+		destination_l = block_a->link_field ().value ().as_account ();
+	}
+	auto is_local_l = [this, &account_a, &destination_l] () {
+		auto transaction_l (wallets.tx_begin_read ());
+		return wallets.exists (transaction_l, account_a) || wallets.exists (transaction_l, *destination_l);
+	};
+	auto const type_l (to_confirmation_type (election_status_a.type));
 
-				if (include_block && !msg_with_block)
-				{
-					msg_with_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, election_votes_a, *conf_options);
-				}
-				else if (!include_block && !msg_without_block)
-				{
-					msg_without_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, election_votes_a, *conf_options);
-				}
+	nano::websocket::confirmation_options default_options (wallets, logger);
+	// Messages are serialized once for each combination of encoding and content options and shared by all sessions
+	std::array<std::optional<nano::shared_const_buffer>, 32> payloads;
+	for (auto const & session_ptr : confirmation_subscriptions.find (account_a, destination_l, is_local_l))
+	{
+		nano::unique_lock<nano::mutex> lk (session_ptr->subscriptions_mutex);
+		auto subscription (session_ptr->subscriptions.find (nano::websocket::topic::confirmation));
+		if (subscription == session_ptr->subscriptions.end ())
+		{
+			continue; // Unsubscribed in the meantime
+		}
+		auto conf_options (dynamic_cast<nano::websocket::confirmation_options *> (subscription->second.get ()));
+		if (conf_options == nullptr)
+		{
+			conf_options = &default_options;
+		}
+		auto include_block (conf_options->get_include_block ());
+		if ((conf_options->get_confirmation_types () & type_l) == 0 || (conf_options->get_has_account_filtering_options () && !include_block))
+		{
+			continue; // Account filters need the block contents to match
+		}
 
-				session_ptr->write (include_block ? msg_with_block.get () : msg_without_block.get ());
-			}
+		auto const binary (conf_options->get_encoding () == nano::websocket::encoding::flatbuffers);
+		auto & payload = payloads[content_options_index (*conf_options) | (binary ? 16 : 0)];
+		if (!payload && binary)
+		{
+			payload.emplace (builder.block_confirmed_flatbuffers (block_a, account_a, amount_a, subtype, include_block, election_status_a, *conf_options));
+		}
+		else if (!payload)
+		{
+			payload.emplace (builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, election_votes_a, *conf_options).to_string ());
 		}
+		lk.unlock ();
+
+		session_ptr->queue (nano::websocket::topic::confirmation, *payload, binary);
 	}
 }
 
 void nano::websocket::listener::broadcast (nano::websocket::message message_a)
 {
+	// Serialized once per encoding, on first use, and shared by all sessions
+	std::optional<nano::shared_const_buffer> payload;
+	std::optional<nano::shared_const_buffer> binary_payload;
+
 	nano::lock_guard<nano::mutex> lk (sessions_mutex);
 	for (auto & weak_session : sessions)
 	{
 		auto session_ptr (weak_session.lock ());
-		if (session_ptr)
+		if (session_ptr && session_ptr->accepts (message_a))
 		{
-			session_ptr->write (message_a);
+			if (message_a.flatbuffers && session_ptr->encoding (message_a.topic) == nano::websocket::encoding::flatbuffers)
+			{
+				if (!binary_payload)
+				{
+					binary_payload.emplace (message_a.flatbuffers ());
+				}
+				session_ptr->queue (message_a.topic, *binary_payload, true);
+			}
+			else
+			{
+				if (!payload)
+				{
+					payload.emplace (message_a.to_string ());
+				}
+				session_ptr->queue (message_a.topic, *payload);
+			}
 		}
 	}
 }
@@ -720,6 +1002,11 @@ nano::websocket::message nano::websocket::message_builder::started_election (nan
 	message_node_l.add ("hash", hash_a.to_string ());
 	message_l.contents.add_child ("message", message_node_l);
 
+	message_l.flatbuffers = [hash_a] () {
+		nanoapi::EventElectionStartedT event_l;
+		event_l.hash = hash_a.to_string ();
+		return to_flatbuffers (event_l);
+	};
 	return message_l;
 }
 
@@ -732,6 +1019,11 @@ nano::websocket::message nano::websocket::message_builder::stopped_election (nan
 	message_node_l.add ("hash", hash_a.to_string ());
 	message_l.contents.add_child ("message", message_node_l);
 
+	message_l.flatbuffers = [hash_a] () {
+		nanoapi::EventElectionStoppedT event_l;
+		event_l.hash = hash_a.to_string ();
+		return to_flatbuffers (event_l);
+	};
 	return message_l;
 }
 
@@ -814,6 +1106,45 @@ nano::websocket::message nano::websocket::message_builder::block_confirmed (std:
 	return message_l;
 }
 
+nano::shared_const_buffer nano::websocket::message_builder::block_confirmed_flatbuffers (std::shared_ptr<nano::block> const & block_a, nano::account const & account_a, nano::amount const & amount_a, std::string const & subtype, bool include_block_a, nano::election_status const & election_status_a, nano::websocket::confirmation_options const & options_a)
+{
+	nanoapi::EventConfirmationT confirmation_l;
+	confirmation_l.account = account_a.to_account ();
+	confirmation_l.amount = amount_a.to_string_dec ();
+	confirmation_l.hash = block_a->hash ().to_string ();
+	switch (election_status_a.type)
+	{
+		case nano::election_status_type::active_confirmation_height:
+			confirmation_l.confirmation_type = nanoapi::TopicConfirmationType::TopicConfirmationType_active_confirmation_height;
+			break;
+		case nano::election_status_type::inactive_confirmation_height:
+			confirmation_l.confirmation_type = nanoapi::TopicConfirmationType::TopicConfirmationType_inactive;
+			break;
+		default:
+			confirmation_l.confirmation_type = nanoapi::TopicConfirmationType::TopicConfirmationType_active_quorum;
+			break;
+	};
+
+	// Votes and sideband info have no equivalent in the schema
+	if (options_a.get_include_election_info () || options_a.get_include_election_info_with_votes ())
+	{
+		confirmation_l.election_info = std::make_unique<nanoapi::ElectionInfoT> ();
+		confirmation_l.election_info->duration = election_status_a.election_duration.count ();
+		confirmation_l.election_info->time = election_status_a.election_end.count ();
+		confirmation_l.election_info->tally = election_status_a.tally.to_string_dec ();
+		confirmation_l.election_info->block_count = election_status_a.block_count;
+		confirmation_l.election_info->voter_count = election_status_a.voter_count;
+		confirmation_l.election_info->request_count = election_status_a.confirmation_request_count;
+	}
+
+	if (include_block_a)
+	{
+		confirmation_l.block = nano::ipc::flatbuffers_builder::block_to_union (*block_a, amount_a, subtype == "send", subtype == "epoch");
+	}
+
+	return to_flatbuffers (confirmation_l);
+}
+
 nano::websocket::message nano::websocket::message_builder::vote_received (std::shared_ptr<nano::vote> const & vote_a, nano::vote_code code_a)
 {
 	nano::websocket::message message_l (nano::websocket::topic::vote);
@@ -845,6 +1176,38 @@ nano::websocket::message nano::websocket::message_builder::vote_received (std::s
 	}
 	vote_node_l.put ("type", vote_type);
 	message_l.contents.add_child ("message", vote_node_l);
+
+	message_l.flatbuffers = [vote_a, code_a] () {
+		nanoapi::EventVoteT event_l;
+		event_l.account = vote_a->account.to_account ();
+		vote_a->signature.encode_hex (event_l.signature);
+		event_l.timestamp = vote_a->timestamp ();
+		event_l.duration = vote_a->duration_bits ();
+		event_l.blocks.reserve (vote_a->hashes.size ());
+		for (auto const & hash : vote_a->hashes)
+		{
+			event_l.blocks.push_back (hash.to_string ());
+		}
+		switch (code_a)
+		{
+			case nano::vote_code::vote:
+				event_l.type = nanoapi::EventVoteType::EventVoteType_vote;
+				break;
+			case nano::vote_code::replay:
+				event_l.type = nanoapi::EventVoteType::EventVoteType_replay;
+				break;
+			case nano::vote_code::indeterminate:
+				event_l.type = nanoapi::EventVoteType::EventVoteType_indeterminate;
+				break;
+			case nano::vote_code::ignored:
+				event_l.type = nanoapi::EventVoteType::EventVoteType_ignored;
+				break;
+			case nano::vote_code::invalid:
+				event_l.type = nanoapi::EventVoteType::EventVoteType_invalid;
+				break;
+		}
+		return to_flatbuffers (event_l);
+	};
 	return message_l;
 }
 
@@ -963,6 +1326,13 @@ nano::websocket::message nano::websocket::message_builder::new_block_arrived (na
 	message_l.contents.put ("hash", block_a.hash ().to_string ());
 	message_l.contents.add_child ("message", block_l);
 
+	auto const & details_l (block_a.sideband ().details);
+	message_l.flatbuffers = [block_l = block_a.clone (), is_send_l = details_l.is_send, is_epoch_l = details_l.is_epoch] () {
+		nanoapi::EventNewBlockT event_l;
+		event_l.hash = block_l->hash ().to_string ();
+		event_l.block = nano::ipc::flatbuffers_builder::block_to_union (*block_l, 0, is_send_l, is_epoch_l);
+		return to_flatbuffers (event_l);
+	};
 	return message_l;
 }
 
@@ -985,11 +1355,12 @@ std::string nano::websocket::message::to_string () const
  * websocket_server
  */
 
-nano::websocket_server::websocket_server (nano::websocket::config & config_a, nano::node_observers & observers_a, nano::wallets & wallets_a, nano::ledger & ledger_a, boost::asio::io_context & io_ctx_a, nano::logger & logger_a) :
+nano::websocket_server::websocket_server (nano::websocket::config & config_a, nano::node_observers & observers_a, nano::wallets & wallets_a, nano::ledger & ledger_a, nano::stats & stats_a, boost::asio::io_context & io_ctx_a, nano::logger & logger_a) :
 	config{ config_a },
 	observers{ observers_a },
 	wallets{ wallets_a },
 	ledger{ ledger_a },
+	stats{ stats_a },
 	io_ctx{ io_ctx_a },
 	logger{ logger_a }
 {
@@ -999,7 +1370,7 @@ nano::websocket_server::websocket_server (nano::websocket::config & config_a, na
 	}
 
 	auto endpoint = nano::tcp_endpoint{ boost::asio::ip::make_address_v6 (config.address), config.port };
-	server = std::make_shared<nano::websocket::listener> (logger, wallets, io_ctx, endpoint);
+	server = std::make_shared<nano::websocket::listener> (config, stats, logger, wallets, io_ctx, endpoint);
 
 	observers.blocks.add ([this] (nano::election_status const & status_a, std::vector<nano::vote_with_weight_info> const & votes_a, nano::account const & account_a, nano::amount const & amount_a, bool is_state_send_a, bool is_state_epoch_a) {
 		debug_assert (status_a.type != nano::election_status_type::ongoing);
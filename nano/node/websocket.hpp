@@ -1,6 +1,9 @@
 #pragma once
 
+#include <nano/lib/asio.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/numbers_templ.hpp>
+#include <nano/lib/stats_enums.hpp>
 #include <nano/lib/work.hpp>
 #include <nano/node/endpoint.hpp>
 #include <nano/node/vote_with_weight_info.hpp>
@@ -11,7 +14,9 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <deque>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -25,6 +30,7 @@ enum class election_status_type : uint8_t;
 class ledger;
 class logger;
 class node_observers;
+class stats;
 class telemetry_data;
 class vote;
 enum class vote_code;
@@ -66,6 +72,20 @@ namespace websocket
 	};
 	constexpr std::size_t number_topics{ static_cast<std::size_t> (topic::_length) - static_cast<std::size_t> (topic::invalid) };
 
+	nano::stat::detail to_stat_detail (topic);
+
+	/** Encoding of the messages sent to a subscription */
+	enum class encoding
+	{
+		/** Text frames with JSON messages */
+		json,
+		/** Binary frames with flatbuffers envelopes, as defined in api/flatbuffers/nanoapi.fbs */
+		flatbuffers
+	};
+
+	/** Returns true if messages of \p topic_a can be sent with the flatbuffers encoding */
+	bool supports_flatbuffers (topic topic_a);
+
 	/** A message queued for broadcasting */
 	class message final
 	{
@@ -82,6 +102,8 @@ namespace websocket
 		std::string to_string () const;
 		nano::websocket::topic topic;
 		boost::property_tree::ptree contents;
+		/** Produces the flatbuffers encoding of this message, empty if the topic has no binary encoding */
+		std::function<nano::shared_const_buffer ()> flatbuffers;
 	};
 
 	/** Message builder. This is expanded with new builder functions are necessary. */
@@ -100,6 +122,9 @@ namespace websocket
 		message telemetry_received (nano::telemetry_data const &, nano::endpoint const &);
 		message new_block_arrived (nano::block const & block_a);
 
+		/** Flatbuffers encoding of a block confirmation, with the same contents as block_confirmed () where the schema allows */
+		nano::shared_const_buffer block_confirmed_flatbuffers (std::shared_ptr<nano::block> const & block_a, nano::account const & account_a, nano::amount const & amount_a, std::string const & subtype, bool include_block, nano::election_status const & election_status_a, nano::websocket::confirmation_options const & options_a);
+
 	private:
 		/** Set the common fields for messages: timestamp and topic. */
 		void set_common_fields (message & message_a);
@@ -111,6 +136,12 @@ namespace websocket
 	public:
 		virtual ~options () = default;
 
+		/** Returns the encoding requested when subscribing */
+		nano::websocket::encoding get_encoding () const
+		{
+			return encoding;
+		}
+
 	protected:
 		/**
 		 * Checks if a message should be filtered for default options (no options given).
@@ -130,6 +161,8 @@ namespace websocket
 			return true;
 		}
 
+		nano::websocket::encoding encoding{ nano::websocket::encoding::json };
+
 		friend class session;
 	};
 
@@ -189,6 +222,30 @@ namespace websocket
 			return include_sideband_info;
 		}
 
+		/** Returns the confirmation types which are broadcasted, a combination of the type_ flags */
+		uint8_t get_confirmation_types () const
+		{
+			return confirmation_types;
+		}
+
+		/** Returns whether confirmations are filtered by the accounts involved */
+		bool get_has_account_filtering_options () const
+		{
+			return has_account_filtering_options;
+		}
+
+		/** Returns whether confirmations involving local wallet accounts are broadcasted */
+		bool get_all_local_accounts () const
+		{
+			return all_local_accounts;
+		}
+
+		/** Returns the accounts for which confirmations are broadcasted */
+		std::unordered_set<nano::account> const & get_accounts () const
+		{
+			return accounts;
+		}
+
 		static constexpr uint8_t const type_active_quorum = 1;
 		static constexpr uint8_t const type_active_confirmation_height = 2;
 		static constexpr uint8_t const type_inactive = 4;
@@ -208,7 +265,7 @@ namespace websocket
 		bool has_account_filtering_options{ false };
 		bool all_local_accounts{ false };
 		uint8_t confirmation_types{ type_all };
-		std::unordered_set<std::string> accounts;
+		std::unordered_set<nano::account> accounts;
 	};
 
 	/**
@@ -262,6 +319,13 @@ namespace websocket
 		void write (nano::websocket::message message_a);
 
 	private:
+		/** Checks whether \p message_a passes the subscription filters of this session */
+		bool accepts (nano::websocket::message const & message_a);
+		/** Returns the encoding of the subscription to \p topic_a, json for topics without a subscription */
+		nano::websocket::encoding encoding (nano::websocket::topic topic_a);
+		/** Enqueue an already serialized message without checking the subscription filters */
+		void queue (nano::websocket::topic topic_a, nano::shared_const_buffer const & payload_a, bool binary_a = false);
+
 		/** The owning listener */
 		nano::websocket::listener & ws_listener;
 		/** Websocket stream, supporting both plain and tls connections */
@@ -270,8 +334,16 @@ namespace websocket
 
 		/** Buffer for received messages */
 		boost::beast::multi_buffer read_buffer;
-		/** Outgoing messages. The send queue is protected by accessing it only through the strand */
-		std::deque<message> send_queue;
+		/** Serialized outgoing message, the payload is shared between all sessions receiving the same broadcast */
+		struct queued_message
+		{
+			nano::websocket::topic topic;
+			nano::shared_const_buffer payload;
+			/** Sent as a binary frame */
+			bool binary;
+		};
+		/** Outgoing messages, the front message is being written. The send queue is protected by accessing it only through the strand */
+		std::deque<queued_message> send_queue;
 
 		/** Cache remote & local endpoints to make them available after the socket is closed */
 		socket_type::endpoint_type remote;
@@ -298,11 +370,43 @@ namespace websocket
 		void write_queued_messages ();
 	};
 
+	/**
+	 * Index of confirmation subscriptions by the accounts they filter on, so each confirmation only visits the sessions interested in it.
+	 * Sessions are referenced by address and must be erased before they are destroyed.
+	 */
+	class confirmation_index final
+	{
+	public:
+		/** Replaces the indexed filter of \p session_a, null \p options_a subscribes to all confirmations */
+		void update (session & session_a, confirmation_options const * options_a);
+		void erase (session & session_a);
+
+		/**
+		 * Sessions that may be interested in a confirmation of a block of \p account_a, optionally sending to \p destination_a.
+		 * Account filters only apply to blocks with a destination, \p is_local_a is only queried if some session filters on local accounts.
+		 */
+		std::vector<std::shared_ptr<session>> find (nano::account const & account_a, std::optional<nano::account> const & destination_a, std::function<bool ()> const & is_local_a) const;
+
+		std::size_t size () const;
+
+	private:
+		mutable nano::mutex mutex;
+		/** Sessions without account filtering */
+		std::unordered_set<session *> unfiltered;
+		/** Sessions filtering on local wallet accounts */
+		std::unordered_set<session *> local;
+		std::unordered_map<nano::account, std::unordered_set<session *>> accounts;
+		/** Accounts indexed for each session, used to remove stale entries */
+		std::unordered_map<session *, std::vector<nano::account>> session_accounts;
+
+		void erase_impl (session & session_a);
+	};
+
 	/** Creates a new session for each incoming connection */
 	class listener final : public std::enable_shared_from_this<listener>
 	{
 	public:
-		listener (nano::logger &, nano::wallets & wallets_a, boost::asio::io_context & io_ctx_a, boost::asio::ip::tcp::endpoint endpoint_a);
+		listener (nano::websocket::config const &, nano::stats &, nano::logger &, nano::wallets & wallets_a, boost::asio::io_context & io_ctx_a, boost::asio::ip::tcp::endpoint endpoint_a);
 
 		/** Start accepting connections */
 		void run ();
@@ -351,12 +455,15 @@ namespace websocket
 		/** Removes from subscription count of a specific topic*/
 		void decrease_subscriber_count (nano::websocket::topic const & topic_a);
 
+		nano::websocket::config const & config;
+		nano::stats & stats;
 		nano::logger & logger;
 		nano::wallets & wallets;
 		boost::asio::ip::tcp::acceptor acceptor;
 		socket_type socket;
 		nano::mutex sessions_mutex;
 		std::vector<std::weak_ptr<session>> sessions;
+		confirmation_index confirmation_subscriptions;
 		std::array<std::atomic<std::size_t>, number_topics> topic_subscriber_count;
 		std::atomic<bool> stopped{ false };
 	};
@@ -368,7 +475,7 @@ namespace websocket
 class websocket_server
 {
 public:
-	websocket_server (nano::websocket::config &, nano::node_observers &, nano::wallets &, nano::ledger &, boost::asio::io_context &, nano::logger &);
+	websocket_server (nano::websocket::config &, nano::node_observers &, nano::wallets &, nano::ledger &, nano::stats &, boost::asio::io_context &, nano::logger &);
 
 	void start ();
 	void stop ();
@@ -378,6 +485,7 @@ private: // Dependencies
 	nano::node_observers & observers;
 	nano::wallets & wallets;
 	nano::ledger & ledger;
+	nano::stats & stats;
 	boost::asio::io_context & io_ctx;
 	nano::logger & logger;
 
@@ -77,6 +77,11 @@ public:
 		ws.close (reason_a, ec_a);
 	}
 
+	void binary (bool value_a) override
+	{
+		ws.binary (value_a);
+	}
+
 	void async_write (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a) override
 	{
 		ws.async_write (buffer_a, boost::asio::bind_executor (strand, callback_a));
@@ -125,6 +130,11 @@ void nano::websocket::stream::close (boost::beast::websocket::close_reason const
 	impl->close (reason_a, ec_a);
 }
 
+void nano::websocket::stream::binary (bool value_a)
+{
+	impl->binary (value_a);
+}
+
 void nano::websocket::stream::async_write (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a)
 {
 	impl->async_write (buffer_a, callback_a);
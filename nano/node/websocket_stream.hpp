@@ -35,6 +35,8 @@ public:
 	virtual socket_type & get_socket () = 0;
 	virtual void handshake (std::function<void (boost::system::error_code const & ec)> callback_a) = 0;
 	virtual void close (boost::beast::websocket::close_reason const & reason_a, boost::system::error_code & ec_a) = 0;
+	/** Selects binary or text frames for subsequent writes */
+	virtual void binary (bool value_a) = 0;
 	virtual void async_write (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a) = 0;
 	virtual void async_read (boost::beast::multi_buffer & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a) = 0;
 };
@@ -55,6 +57,7 @@ public:
 	[[nodiscard]] socket_type & get_socket () override;
 	void handshake (std::function<void (boost::system::error_code const & ec)> callback_a) override;
 	void close (boost::beast::websocket::close_reason const & reason_a, boost::system::error_code & ec_a) override;
+	void binary (bool value_a) override;
 	void async_write (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a) override;
 	void async_read (boost::beast::multi_buffer & buffer_a, std::function<void (boost::system::error_code, std::size_t)> callback_a) override;
 
@@ -14,6 +14,7 @@ nano::error nano::websocket::config::serialize_toml (nano::tomlconfig & toml) co
 	toml.put ("enable", enabled, "Enable or disable WebSocket server.\ntype:bool");
 	toml.put ("address", address, "WebSocket server bind address.\ntype:string,ip");
 	toml.put ("port", port, "WebSocket server listening port.\ntype:uint16");
+	toml.put ("max_queued_messages", max_queued_messages, "Maximum number of messages queued for a single session. When a client can't keep up, the oldest queued messages are dropped.\ntype:uint64");
 	return toml.get_error ();
 }
 
@@ -24,5 +25,6 @@ nano::error nano::websocket::config::deserialize_toml (nano::tomlconfig & toml)
 	toml.get_optional<boost::asio::ip::address_v6> ("address", address_l, boost::asio::ip::address_v6::loopback ());
 	address = address_l.to_string ();
 	toml.get<uint16_t> ("port", port);
+	toml.get<std::size_t> ("max_queued_messages", max_queued_messages);
 	return toml.get_error ();
 }
@@ -21,6 +21,8 @@ namespace websocket
 		bool enabled{ false };
 		uint16_t port;
 		std::string address;
+		/** Messages queued for a single session before the oldest ones are dropped */
+		std::size_t max_queued_messages{ 1024 };
 	};
 }
 }
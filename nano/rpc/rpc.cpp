@@ -66,6 +66,11 @@ void nano::rpc::accept ()
 		}
 		if (!ec)
 		{
+			{
+				nano::lock_guard<nano::mutex> guard{ this_l->connections_mutex };
+				std::erase_if (this_l->connections, [] (auto const & connection) { return connection.expired (); });
+				this_l->connections.push_back (connection);
+			}
 			connection->parse_connection ();
 		}
 		else
@@ -79,6 +84,16 @@ void nano::rpc::stop ()
 {
 	stopped = true;
 	acceptor.close ();
+
+	nano::lock_guard<nano::mutex> guard{ connections_mutex };
+	for (auto const & connection_w : connections)
+	{
+		if (auto connection = connection_w.lock ())
+		{
+			connection->close ();
+		}
+	}
+	connections.clear ();
 }
 
 std::shared_ptr<nano::rpc> nano::get_rpc (std::shared_ptr<boost::asio::io_context> io_ctx_a, nano::rpc_config const & config_a, nano::rpc_handler_interface & rpc_handler_interface_a)
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <nano/boost/asio/ip/tcp.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/rpc_handler_interface.hpp>
 #include <nano/lib/rpcconfig.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace boost
 {
 namespace asio
@@ -15,6 +19,7 @@ namespace asio
 
 namespace nano
 {
+class rpc_connection;
 class rpc_handler_interface;
 
 class rpc : public std::enable_shared_from_this<rpc>
@@ -41,6 +46,11 @@ public:
 	boost::asio::ip::tcp::acceptor acceptor;
 	nano::rpc_handler_interface & rpc_handler_interface;
 	bool stopped{ false };
+
+private:
+	// Connections are kept alive between requests, they are closed when stopping
+	nano::mutex connections_mutex;
+	std::vector<std::weak_ptr<nano::rpc_connection>> connections;
 };
 
 /** Returns the correct RPC implementation based on TLS configuration */
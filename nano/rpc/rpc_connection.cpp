@@ -16,6 +16,7 @@
 nano::rpc_connection::rpc_connection (nano::rpc_config const & rpc_config, boost::asio::io_context & io_ctx, nano::logger & logger, nano::rpc_handler_interface & rpc_handler_interface) :
 	socket (io_ctx),
 	strand (io_ctx.get_executor ()),
+	chunks_timer (io_ctx),
 	io_ctx (io_ctx),
 	logger (logger),
 	rpc_config (rpc_config),
@@ -38,7 +39,7 @@ void nano::rpc_connection::prepare_head (unsigned version, boost::beast::http::s
 	res.set (boost::beast::http::field::access_control_allow_origin, "*");
 	res.set (boost::beast::http::field::access_control_allow_methods, "POST, OPTIONS");
 	res.set (boost::beast::http::field::access_control_allow_headers, "Accept, Accept-Language, Content-Language, Content-Type");
-	res.set (boost::beast::http::field::connection, "close");
+	res.set (boost::beast::http::field::connection, keep_alive ? "keep-alive" : "close");
 }
 
 void nano::rpc_connection::write_result (std::string body, unsigned version, boost::beast::http::status status)
@@ -55,9 +56,216 @@ void nano::rpc_connection::write_result (std::string body, unsigned version, boo
 	}
 }
 
-void nano::rpc_connection::write_completion_handler (std::shared_ptr<nano::rpc_connection> const & rpc_connection)
+void nano::rpc_connection::write_completion_handler (std::shared_ptr<nano::rpc_connection> const & rpc_connection, boost::system::error_code const & ec)
 {
-	// Intentional no-op
+	if (!ec && keep_alive)
+	{
+		reset ();
+		read (socket);
+	}
+}
+
+void nano::rpc_connection::close ()
+{
+	boost::asio::post (strand, [this_l = shared_from_this ()] () {
+		this_l->chunks_timer.cancel ();
+		boost::system::error_code ignored;
+		this_l->socket.close (ignored);
+	});
+}
+
+void nano::rpc_connection::reset ()
+{
+	res = {};
+	responded.clear ();
+	keep_alive = false;
+	chunked_res = {};
+	chunked_serializer.reset ();
+	chunks_header_written = false;
+	chunks_finished = false;
+
+	nano::lock_guard<nano::mutex> guard{ chunks_mutex };
+	debug_assert (chunks.empty ());
+	debug_assert (!chunks_next);
+	chunks_size = 0;
+	chunked = false;
+	chunks_last = false;
+	chunks_failed = false;
+}
+
+template <typename STREAM_TYPE>
+void nano::rpc_connection::write_chunk (STREAM_TYPE & stream, std::string const & data, bool last, unsigned version, std::function<void (bool)> next)
+{
+	nano::unique_lock<nano::mutex> lock{ chunks_mutex };
+	if (!chunked)
+	{
+		if (responded.test_and_set ())
+		{
+			debug_assert (false && "RPC already responded and should only respond once");
+			return;
+		}
+		chunked = true;
+		prepare_head (version);
+		chunked_res.base () = res.base ();
+		chunked_res.chunked (true);
+	}
+	debug_assert (!chunks_last);
+	debug_assert (!chunks_next);
+	if (chunks_failed)
+	{
+		lock.unlock ();
+		if (next)
+		{
+			next (false);
+		}
+		return;
+	}
+	// An empty chunk would terminate the body
+	if (!data.empty ())
+	{
+		chunks.push_back (std::make_shared<std::string> (data));
+		chunks_size += data.size ();
+	}
+	chunks_last = last;
+	bool const ready = chunks_size < max_queued_chunks_size;
+	if (!last && !ready)
+	{
+		// Resumed by the write completion once the client has read enough of the queued output
+		chunks_next = std::move (next);
+	}
+	lock.unlock ();
+
+	boost::asio::post (strand, [this_l = shared_from_this (), &stream, waiting = !last && !ready] () {
+		if (waiting)
+		{
+			this_l->chunks_wait_timeout ();
+		}
+		this_l->write_chunks (stream);
+	});
+	if (!last && ready)
+	{
+		next (true);
+	}
+}
+
+template <typename STREAM_TYPE>
+void nano::rpc_connection::write_chunks (STREAM_TYPE & stream)
+{
+	if (chunks_writing)
+	{
+		return; // The completion of the current write continues with the next chunk
+	}
+	auto this_l (shared_from_this ());
+	if (!chunks_header_written)
+	{
+		chunks_writing = true;
+		chunked_serializer = std::make_shared<boost::beast::http::response_serializer<boost::beast::http::empty_body>> (chunked_res);
+		boost::beast::http::async_write_header (stream, *chunked_serializer, boost::asio::bind_executor (strand, [this_l, &stream] (boost::system::error_code const & ec, size_t bytes_transferred) {
+			this_l->chunks_writing = false;
+			this_l->chunks_header_written = true;
+			if (!ec)
+			{
+				this_l->write_chunks (stream);
+			}
+			else
+			{
+				this_l->chunks_fail ();
+			}
+		}));
+		return;
+	}
+
+	nano::unique_lock<nano::mutex> lock{ chunks_mutex };
+	if (chunks_failed)
+	{
+		return;
+	}
+	if (!chunks.empty ())
+	{
+		auto chunk = chunks.front ();
+		lock.unlock ();
+		chunks_writing = true;
+		boost::asio::async_write (stream, boost::beast::http::make_chunk (boost::asio::buffer (*chunk)), boost::asio::bind_executor (strand, [this_l, chunk, &stream] (boost::system::error_code const & ec, size_t bytes_transferred) {
+			this_l->chunks_writing = false;
+			std::function<void (bool)> next;
+			{
+				nano::lock_guard<nano::mutex> guard{ this_l->chunks_mutex };
+				this_l->chunks.pop_front ();
+				this_l->chunks_size -= chunk->size ();
+				if (!ec && this_l->chunks_next && this_l->chunks_size < max_queued_chunks_size)
+				{
+					next.swap (this_l->chunks_next);
+				}
+			}
+			if (next)
+			{
+				this_l->chunks_timer.cancel ();
+				next (true);
+			}
+			if (!ec)
+			{
+				this_l->write_chunks (stream);
+			}
+			else
+			{
+				this_l->chunks_fail ();
+			}
+		}));
+	}
+	else if (chunks_last && !chunks_finished)
+	{
+		lock.unlock ();
+		chunks_finished = true;
+		chunks_writing = true;
+		boost::asio::async_write (stream, boost::beast::http::make_chunk_last (), boost::asio::bind_executor (strand, [this_l] (boost::system::error_code const & ec, size_t bytes_transferred) {
+			this_l->chunks_writing = false;
+			this_l->write_completion_handler (this_l, ec);
+		}));
+	}
+}
+
+void nano::rpc_connection::chunks_wait_timeout ()
+{
+	{
+		nano::lock_guard<nano::mutex> guard{ chunks_mutex };
+		if (!chunks_next)
+		{
+			return; // Already resumed
+		}
+	}
+	chunks_timer.expires_after (chunk_write_timeout);
+	chunks_timer.async_wait (boost::asio::bind_executor (strand, [this_l = shared_from_this ()] (boost::system::error_code const & ec) {
+		if (ec)
+		{
+			return; // Cancelled, the client made progress
+		}
+		bool waiting = false;
+		{
+			nano::lock_guard<nano::mutex> guard{ this_l->chunks_mutex };
+			waiting = this_l->chunks_next != nullptr;
+		}
+		if (waiting)
+		{
+			this_l->logger.error (nano::log::type::rpc_connection, "RPC client is not reading the response, closing connection");
+			this_l->chunks_fail ();
+			boost::system::error_code ignored;
+			this_l->socket.close (ignored);
+		}
+	}));
+}
+
+void nano::rpc_connection::chunks_fail ()
+{
+	std::function<void (bool)> next;
+	{
+		nano::lock_guard<nano::mutex> guard{ chunks_mutex };
+		chunks_failed = true;
+		next.swap (chunks_next);
+	}
+	if (next)
+	{
+		next (false);
+	}
 }
 
 template <typename STREAM_TYPE>
@@ -81,6 +289,10 @@ void nano::rpc_connection::read (STREAM_TYPE & stream)
 
 			this_l->parse_request (stream, header_parser);
 		}
+		else if (ec == boost::beast::http::error::end_of_stream || ec == boost::asio::error::operation_aborted)
+		{
+			// The client closed the connection between requests, or it was closed when stopping
+		}
 		else
 		{
 			this_l->logger.error (nano::log::type::rpc_connection, "RPC header error: ", ec.message ());
@@ -89,7 +301,7 @@ void nano::rpc_connection::read (STREAM_TYPE & stream)
 			auto response_handler ([this_l, &stream] (std::string const & tree_a) {
 				this_l->write_result (tree_a, 11);
 				boost::beast::http::async_write (stream, this_l->res, boost::asio::bind_executor (this_l->strand, [this_l] (boost::system::error_code const & ec, size_t bytes_transferred) {
-					this_l->write_completion_handler (this_l);
+					this_l->write_completion_handler (this_l, ec);
 				}));
 			});
 			nano::json_error_response (response_handler, std::string ("Invalid header: ") + ec.message ());
@@ -110,6 +322,7 @@ void nano::rpc_connection::parse_request (STREAM_TYPE & stream, std::shared_ptr<
 		{
 			this_l->io_ctx.post ([this_l, body_parser, header_field_credentials_l, header_corr_id_l, path_l, &stream] () {
 				auto & req (body_parser->get ());
+				this_l->keep_alive = req.keep_alive ();
 				auto start (std::chrono::steady_clock::now ());
 				auto version (req.version ());
 				std::stringstream ss;
@@ -119,7 +332,7 @@ void nano::rpc_connection::parse_request (STREAM_TYPE & stream, std::shared_ptr<
 					auto body = tree_a;
 					this_l->write_result (body, version);
 					boost::beast::http::async_write (stream, this_l->res, boost::asio::bind_executor (this_l->strand, [this_l] (boost::system::error_code const & ec, size_t bytes_transferred) {
-						this_l->write_completion_handler (this_l);
+						this_l->write_completion_handler (this_l, ec);
 					}));
 
 					// Bump logging level if RPC request logging is enabled
@@ -127,6 +340,21 @@ void nano::rpc_connection::parse_request (STREAM_TYPE & stream, std::shared_ptr<
 					nano::log::type::rpc_request, "RPC request {} completed in {} microseconds", request_id, std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start).count ());
 				});
 
+				auto chunk_handler ([this_l, version, start, request_id, response_handler, &stream] (std::string const & data_a, bool last_a, std::function<void (bool)> next_a) {
+					// Responses produced in a single piece are sent with a content length
+					if (last_a && !this_l->chunked)
+					{
+						response_handler (data_a);
+						return;
+					}
+					this_l->write_chunk (stream, data_a, last_a, version, std::move (next_a));
+					if (last_a)
+					{
+						this_l->logger.log (this_l->rpc_config.rpc_logging.log_rpc ? nano::log::level::info : nano::log::level::debug,
+						nano::log::type::rpc_request, "RPC request {} completed in {} microseconds", request_id, std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start).count ());
+					}
+				});
+
 				std::string api_path_l = "/api/v2";
 				int rpc_version_l = boost::starts_with (path_l, api_path_l) ? 2 : 1;
 
@@ -135,7 +363,7 @@ void nano::rpc_connection::parse_request (STREAM_TYPE & stream, std::shared_ptr<
 				{
 					case boost::beast::http::verb::post:
 					{
-						auto handler (std::make_shared<nano::rpc_handler> (this_l->rpc_config, req.body (), request_id, response_handler, this_l->rpc_handler_interface, this_l->logger));
+						auto handler (std::make_shared<nano::rpc_handler> (this_l->rpc_config, req.body (), request_id, response_handler, chunk_handler, this_l->rpc_handler_interface, this_l->logger));
 						nano::rpc_handler_request_params request_params;
 						request_params.rpc_version = rpc_version_l;
 						request_params.credentials = header_field_credentials_l;
@@ -150,7 +378,7 @@ void nano::rpc_connection::parse_request (STREAM_TYPE & stream, std::shared_ptr<
 						this_l->prepare_head (version);
 						this_l->res.prepare_payload ();
 						boost::beast::http::async_write (stream, this_l->res, boost::asio::bind_executor (this_l->strand, [this_l] (boost::system::error_code const & ec, size_t bytes_transferred) {
-							this_l->write_completion_handler (this_l);
+							this_l->write_completion_handler (this_l, ec);
 						}));
 						break;
 					}
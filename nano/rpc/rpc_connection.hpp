@@ -1,14 +1,19 @@
 #pragma once
 
 #include <nano/boost/asio/ip/tcp.hpp>
+#include <nano/boost/asio/steady_timer.hpp>
 #include <nano/boost/asio/strand.hpp>
 #include <nano/boost/beast/core/flat_buffer.hpp>
 #include <nano/boost/beast/http.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/logging.hpp>
 
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
 
 /* Boost v1.70 introduced breaking changes; the conditional compilation allows 1.6x to be supported as well. */
 #if BOOST_VERSION < 107000
@@ -28,9 +33,18 @@ public:
 	rpc_connection (nano::rpc_config const & rpc_config, boost::asio::io_context & io_ctx, nano::logger &, nano::rpc_handler_interface & rpc_handler_interface_a);
 	virtual ~rpc_connection () = default;
 	virtual void parse_connection ();
-	virtual void write_completion_handler (std::shared_ptr<nano::rpc_connection> const & rpc_connection);
+	virtual void write_completion_handler (std::shared_ptr<nano::rpc_connection> const & rpc_connection, boost::system::error_code const & ec);
+	/** Closes the connection from any thread, aborting a request in progress or the wait for the next one */
+	void close ();
 	void prepare_head (unsigned version, boost::beast::http::status status = boost::beast::http::status::ok);
 	void write_result (std::string body, unsigned version, boost::beast::http::status status = boost::beast::http::status::ok);
+	/**
+	 * Queues the next piece of a response sent with chunked transfer encoding, called from the thread producing the response.
+	 * Never waits for the client, `next` is called once little enough output is queued for the producer to continue,
+	 * so memory use does not depend on the size of the response. It is called with false if the response can no longer be delivered.
+	 */
+	template <typename STREAM_TYPE>
+	void write_chunk (STREAM_TYPE & stream, std::string const & data, bool last, unsigned version, std::function<void (bool)> next);
 
 	socket_type socket;
 	boost::beast::flat_buffer buffer;
@@ -41,6 +55,13 @@ public:
 	nano::logger & logger;
 	nano::rpc_config const & rpc_config;
 	nano::rpc_handler_interface & rpc_handler_interface;
+	// Whether the client asked for the connection to stay open for further requests once the response is written
+	bool keep_alive{ false };
+
+	// Bytes of a chunked response that may be queued before the producer has to wait for the client
+	static std::size_t constexpr max_queued_chunks_size = 256 * 1024;
+	// A client that keeps the producer waiting for this long is disconnected
+	static std::chrono::seconds constexpr chunk_write_timeout{ 30 };
 
 protected:
 	template <typename STREAM_TYPE>
@@ -48,5 +69,29 @@ protected:
 
 	template <typename STREAM_TYPE>
 	void parse_request (STREAM_TYPE & stream, std::shared_ptr<boost::beast::http::request_parser<boost::beast::http::empty_body>> const & header_parser);
+
+	template <typename STREAM_TYPE>
+	void write_chunks (STREAM_TYPE & stream);
+	void chunks_wait_timeout ();
+	void chunks_fail ();
+	// Clears the state of the previous response before reading the next request of a kept alive connection
+	void reset ();
+
+private: // Chunked response state, the write flags and timer are only accessed from the strand
+	boost::beast::http::response<boost::beast::http::empty_body> chunked_res;
+	std::shared_ptr<boost::beast::http::response_serializer<boost::beast::http::empty_body>> chunked_serializer;
+	boost::asio::steady_timer chunks_timer;
+	bool chunks_writing{ false };
+	bool chunks_header_written{ false };
+	bool chunks_finished{ false };
+
+	nano::mutex chunks_mutex;
+	std::deque<std::shared_ptr<std::string>> chunks;
+	std::size_t chunks_size{ 0 };
+	// Continuation of the producer while it waits for the queued output to drain
+	std::function<void (bool)> chunks_next;
+	bool chunked{ false };
+	bool chunks_last{ false };
+	bool chunks_failed{ false };
 };
 }
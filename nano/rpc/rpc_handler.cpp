@@ -17,10 +17,11 @@ std::unordered_set<std::string> rpc_control_impl_set = create_rpc_control_impls
 std::string filter_request (boost::property_tree::ptree tree_a);
 }
 
-nano::rpc_handler::rpc_handler (nano::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void (std::string const &)> const & response_a, nano::rpc_handler_interface & rpc_handler_interface_a, nano::logger & logger) :
+nano::rpc_handler::rpc_handler (nano::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void (std::string const &)> const & response_a, nano::rpc_handler_interface::chunk_t const & chunk_a, nano::rpc_handler_interface & rpc_handler_interface_a, nano::logger & logger) :
 	body (body_a),
 	request_id (request_id_a),
 	response (response_a),
+	chunk (chunk_a),
 	rpc_config (rpc_config),
 	rpc_handler_interface (rpc_handler_interface_a),
 	logger (logger)
@@ -112,7 +113,7 @@ void nano::rpc_handler::process_request (nano::rpc_handler_request_params const
 
 				if (!error)
 				{
-					rpc_handler_interface.process_request (action, body, this->response);
+					rpc_handler_interface.process_request_chunked (action, body, this->chunk);
 				}
 			}
 			else if (request_params.rpc_version == 2)
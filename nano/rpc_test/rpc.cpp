@@ -2,6 +2,7 @@
 #include <nano/boost/beast/http.hpp>
 #include <nano/lib/block_type.hpp>
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/json_writer.hpp>
 #include <nano/lib/jsonconfig.hpp>
 #include <nano/lib/rpcconfig.hpp>
 #include <nano/lib/thread_runner.hpp>
@@ -2953,6 +2954,10 @@ TEST (rpc, accounts_balances_unopened_account_with_receivables)
 	boost::property_tree::ptree entry;
 	entry.put ("", unopened_account.pub.to_account ());
 	accounts_l.push_back (std::make_pair ("", entry));
+	// The sender's head block is not confirmed, its confirmed balance comes from the confirmed frontier
+	boost::property_tree::ptree genesis_entry;
+	genesis_entry.put ("", nano::dev::genesis_key.pub.to_account ());
+	accounts_l.push_back (std::make_pair ("", genesis_entry));
 	request.add_child ("accounts", accounts_l);
 	request.put ("action", "accounts_balances");
 
@@ -2961,6 +2966,7 @@ TEST (rpc, accounts_balances_unopened_account_with_receivables)
 	auto response_entry = response.get_child ("balances." + unopened_account.pub.to_account ());
 	ASSERT_EQ ("0", response_entry.get<std::string> ("balance"));
 	ASSERT_EQ ("0", response_entry.get<std::string> ("receivable"));
+	ASSERT_EQ (nano::dev::constants.genesis_amount.convert_to<std::string> (), response.get<std::string> ("balances." + nano::dev::genesis_key.pub.to_account () + ".balance"));
 
 	// check unconfirmed receivable amount
 	request.put ("include_only_confirmed", "false");
@@ -2968,6 +2974,7 @@ TEST (rpc, accounts_balances_unopened_account_with_receivables)
 	response_entry = response.get_child ("balances." + unopened_account.pub.to_account ());
 	ASSERT_EQ ("0", response_entry.get<std::string> ("balance"));
 	ASSERT_EQ ("1", response_entry.get<std::string> ("receivable"));
+	ASSERT_EQ ((nano::dev::constants.genesis_amount - 1).convert_to<std::string> (), response.get<std::string> ("balances." + nano::dev::genesis_key.pub.to_account () + ".balance"));
 
 	// check confirmed receivable amount by explicitly setting include_only_confirmed
 	request.put ("include_only_confirmed", "true");
@@ -6065,6 +6072,93 @@ TEST (rpc, in_process)
 	ASSERT_EQ ("0", pending_text);
 }
 
+// Streamed responses are sent in several chunks and the connection stays open for the next request
+TEST (rpc, in_process_chunked_keep_alive)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	// Every hash listed takes about 70 bytes, so the response spans several 64KB chunks
+	auto blocks = nano::test::setup_chain (system, *node, 3000, nano::dev::genesis_key, false);
+	nano::node_rpc_config node_rpc_config;
+	nano::ipc::ipc_server ipc_server (*node, node_rpc_config);
+	nano::rpc_config rpc_config{ nano::dev::network_params.network, system.get_available_port (), true };
+	// Responses received over IPC are never streamed
+	nano::inprocess_rpc_handler inprocess_rpc_handler (*node, ipc_server, node_rpc_config);
+	auto rpc = std::make_shared<nano::rpc> (system.io_ctx, rpc_config, inprocess_rpc_handler);
+	nano::test::start_stop_guard stop_guard{ *rpc };
+
+	boost::asio::ip::tcp::socket socket (*system.io_ctx);
+	boost::system::error_code ec;
+	socket.connect (nano::tcp_endpoint (boost::asio::ip::address_v6::loopback (), rpc->listening_port ()), ec);
+	ASSERT_FALSE (ec);
+	boost::beast::flat_buffer buffer;
+	auto send_request = [&socket] (boost::property_tree::ptree const & request_a) {
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, request_a);
+		boost::beast::http::request<boost::beast::http::string_body> req{ boost::beast::http::verb::post, "/", 11 };
+		req.keep_alive (true);
+		req.body () = ostream.str ();
+		req.prepare_payload ();
+		boost::system::error_code ec;
+		boost::beast::http::write (socket, req, ec);
+		return !ec;
+	};
+
+	boost::property_tree::ptree request;
+	request.put ("action", "successors");
+	request.put ("block", nano::dev::genesis->hash ().to_string ());
+	request.put ("count", std::to_string (std::numeric_limits<uint64_t>::max ()));
+	ASSERT_TRUE (send_request (request));
+	boost::beast::http::response_parser<boost::beast::http::string_body> parser;
+	size_t chunks = 0;
+	auto on_chunk_header = [&chunks] (std::uint64_t size, boost::beast::string_view extensions, boost::system::error_code & ec) {
+		++chunks;
+	};
+	parser.on_chunk_header (on_chunk_header);
+	std::atomic<bool> done{ false };
+	boost::beast::http::async_read (socket, buffer, parser, [&ec, &done] (boost::system::error_code const & ec_a, size_t bytes_transferred) {
+		ec = ec_a;
+		done = true;
+	});
+	ASSERT_TIMELY (10s, done);
+	ASSERT_FALSE (ec);
+	auto const & response = parser.get ();
+	ASSERT_TRUE (response.chunked ());
+	ASSERT_TRUE (response.keep_alive ());
+	ASSERT_GT (response.body ().size (), 2 * nano::json_writer::default_chunk_size);
+	// Includes the empty chunk terminating the body
+	ASSERT_GT (chunks, 3);
+	boost::property_tree::ptree json;
+	std::stringstream body (response.body ());
+	boost::property_tree::read_json (body, json);
+	std::vector<nano::block_hash> hashes;
+	for (auto const & entry : json.get_child ("blocks"))
+	{
+		hashes.push_back (nano::block_hash (entry.second.get<std::string> ("")));
+	}
+	ASSERT_EQ (blocks.size () + 1, hashes.size ());
+	ASSERT_EQ (nano::dev::genesis->hash (), hashes.front ());
+	ASSERT_EQ (blocks.back ()->hash (), hashes.back ());
+
+	// The same connection serves the next request
+	boost::property_tree::ptree request2;
+	request2.put ("action", "block_count");
+	ASSERT_TRUE (send_request (request2));
+	boost::beast::http::response<boost::beast::http::string_body> response2;
+	done = false;
+	boost::beast::http::async_read (socket, buffer, response2, [&ec, &done] (boost::system::error_code const & ec_a, size_t bytes_transferred) {
+		ec = ec_a;
+		done = true;
+	});
+	ASSERT_TIMELY (5s, done);
+	ASSERT_FALSE (ec);
+	ASSERT_FALSE (response2.chunked ());
+	boost::property_tree::ptree json2;
+	std::stringstream body2 (response2.body ());
+	boost::property_tree::read_json (body2, json2);
+	ASSERT_EQ (std::to_string (blocks.size () + 1), json2.get<std::string> ("count"));
+}
+
 TEST (rpc, deprecated_account_format)
 {
 	nano::test::system system;
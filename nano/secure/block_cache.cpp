@@ -0,0 +1,184 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/lib/tomlconfig.hpp>
+#include <nano/secure/block_cache.hpp>
+#include <nano/store/block.hpp>
+
+nano::block_cache::block_cache (nano::block_cache_config const & config_a, nano::store::block & store_a, nano::stats & stats_a) :
+	config{ config_a },
+	store{ store_a },
+	stats{ stats_a },
+	shard_memory{ config_a.max_memory / shard_count }
+{
+}
+
+bool nano::block_cache::enabled () const
+{
+	return shard_memory > 0;
+}
+
+std::shared_ptr<nano::block> nano::block_cache::get (nano::store::transaction const & transaction, nano::block_hash const & hash)
+{
+	if (!enabled ())
+	{
+		return store.get (transaction, hash);
+	}
+
+	auto & shard = shard_for (hash);
+	if (auto block = cached (shard, hash))
+	{
+		// The cached copy might predate changes visible to this transaction (successor updates, rollbacks), the stored sideband is authoritative
+		auto sideband = store.sideband (transaction, hash);
+		if (sideband && sideband->successor == block->sideband ().successor && sideband->height == block->sideband ().height && sideband->timestamp == block->sideband ().timestamp)
+		{
+			stats.inc (nano::stat::type::block_cache, nano::stat::detail::hit);
+			return block;
+		}
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::stale);
+	}
+	else
+	{
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::miss);
+	}
+
+	auto block = store.get (transaction, hash);
+	if (block)
+	{
+		insert (shard, hash, block);
+	}
+	else
+	{
+		erase (hash);
+	}
+	return block;
+}
+
+std::shared_ptr<nano::block> nano::block_cache::cached (shard & shard, nano::block_hash const & hash)
+{
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+	auto & by_hash = shard.entries.get<tag_hash> ();
+	if (auto existing = by_hash.find (hash); existing != by_hash.end ())
+	{
+		// Move to the front of the LRU list
+		shard.entries.relocate (shard.entries.begin (), shard.entries.project<tag_sequenced> (existing));
+		return existing->block;
+	}
+	return nullptr;
+}
+
+void nano::block_cache::insert (shard & shard, nano::block_hash const & hash, std::shared_ptr<nano::block> const & block)
+{
+	auto const block_cost = cost (*block);
+
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+	auto & by_hash = shard.entries.get<tag_hash> ();
+	if (auto existing = by_hash.find (hash); existing != by_hash.end ())
+	{
+		shard.memory -= existing->cost;
+		by_hash.erase (existing);
+	}
+	if (block_cost > shard_memory)
+	{
+		return;
+	}
+	shard.entries.push_front ({ hash, block, block_cost });
+	shard.memory += block_cost;
+	stats.inc (nano::stat::type::block_cache, nano::stat::detail::inserted);
+
+	// Evict least recently used entries until the shard fits in its memory budget
+	while (shard.memory > shard_memory)
+	{
+		debug_assert (!shard.entries.empty ());
+		shard.memory -= shard.entries.back ().cost;
+		shard.entries.pop_back ();
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::evicted);
+	}
+}
+
+void nano::block_cache::erase (nano::block_hash const & hash)
+{
+	if (!enabled ())
+	{
+		return;
+	}
+
+	auto & shard = shard_for (hash);
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+	auto & by_hash = shard.entries.get<tag_hash> ();
+	if (auto existing = by_hash.find (hash); existing != by_hash.end ())
+	{
+		shard.memory -= existing->cost;
+		by_hash.erase (existing);
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::erased);
+	}
+}
+
+void nano::block_cache::clear ()
+{
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		shard.entries.clear ();
+		shard.memory = 0;
+	}
+}
+
+std::size_t nano::block_cache::size () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		result += shard.entries.size ();
+	}
+	return result;
+}
+
+std::size_t nano::block_cache::memory () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		result += shard.memory;
+	}
+	return result;
+}
+
+auto nano::block_cache::shard_for (nano::block_hash const & hash) -> shard &
+{
+	return shards[hash.qwords[0] % shard_count];
+}
+
+std::size_t nano::block_cache::cost (nano::block const & block)
+{
+	// Approximation of the heap usage of a deserialized block, including the cache entry and hash index node
+	std::size_t constexpr overhead = 128;
+	return nano::block::size (block.type ()) + nano::block_sideband::size (block.type ()) + overhead;
+}
+
+nano::container_info nano::block_cache::container_info () const
+{
+	nano::container_info info;
+	info.put ("blocks", size ());
+	info.put ("memory", memory ());
+	return info;
+}
+
+/*
+ * block_cache_config
+ */
+
+nano::error nano::block_cache_config::serialize (nano::tomlconfig & toml) const
+{
+	toml.put ("max_memory", max_memory, "Approximate memory in bytes used to keep recently accessed blocks deserialized, 0 disables the cache. \ntype:uint64");
+
+	return toml.get_error ();
+}
+
+nano::error nano::block_cache_config::deserialize (nano::tomlconfig & toml)
+{
+	toml.get ("max_memory", max_memory);
+
+	return toml.get_error ();
+}
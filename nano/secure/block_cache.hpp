@@ -0,0 +1,103 @@
+#pragma once
+
+#include <nano/lib/errors.hpp>
+#include <nano/lib/fwd.hpp>
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/numbers_templ.hpp>
+#include <nano/store/fwd.hpp>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <array>
+#include <memory>
+
+namespace mi = boost::multi_index;
+
+namespace nano
+{
+class stats;
+}
+
+namespace nano
+{
+class block_cache_config final
+{
+public:
+	nano::error deserialize (nano::tomlconfig & toml);
+	nano::error serialize (nano::tomlconfig & toml) const;
+
+public:
+	// Approximate memory used by cached blocks, 0 disables the cache
+	std::size_t max_memory{ 64 * 1024 * 1024 };
+};
+
+/**
+ * Keeps recently loaded blocks in deserialized form, so repeated lookups skip block deserialization.
+ * A cached block is only returned after checking that its sideband still matches the one stored in the ledger,
+ * which keeps results consistent with the transaction used for the lookup, regardless of when the entry was cached.
+ * Entries for removed blocks must be erased explicitly (rollback, pruning), otherwise they are only dropped on the next failed check.
+ */
+class block_cache final
+{
+public:
+	block_cache (nano::block_cache_config const &, nano::store::block &, nano::stats &);
+
+	std::shared_ptr<nano::block> get (nano::store::transaction const &, nano::block_hash const &);
+	void erase (nano::block_hash const &);
+	void clear ();
+
+	bool enabled () const;
+	std::size_t size () const;
+	std::size_t memory () const;
+
+	nano::container_info container_info () const;
+
+public:
+	static std::size_t constexpr shard_count = 16;
+
+private: // Dependencies
+	nano::block_cache_config const config;
+	nano::store::block & store;
+	nano::stats & stats;
+
+private:
+	static std::size_t cost (nano::block const &);
+
+	struct entry
+	{
+		nano::block_hash hash;
+		std::shared_ptr<nano::block> block;
+		std::size_t cost;
+	};
+
+	// clang-format off
+	class tag_sequenced {};
+	class tag_hash {};
+
+	using ordered_entries = boost::multi_index_container<entry,
+	mi::indexed_by<
+		mi::sequenced<mi::tag<tag_sequenced>>,
+		mi::hashed_unique<mi::tag<tag_hash>,
+			mi::member<entry, nano::block_hash, &entry::hash>>
+	>>;
+	// clang-format on
+
+	struct alignas (64) shard
+	{
+		ordered_entries entries;
+		std::size_t memory{ 0 };
+		mutable nano::mutex mutex;
+	};
+
+	shard & shard_for (nano::block_hash const &);
+	std::shared_ptr<nano::block> cached (shard &, nano::block_hash const &);
+	void insert (shard &, nano::block_hash const &, std::shared_ptr<nano::block> const &);
+
+	std::size_t const shard_memory;
+	std::array<shard, shard_count> shards;
+};
+}
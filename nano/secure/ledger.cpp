@@ -1,5 +1,6 @@
 #include <nano/lib/block_type.hpp>
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/config.hpp>
 #include <nano/lib/files.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
@@ -16,6 +17,7 @@
 #include <nano/store/block.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/delegator.hpp>
 #include <nano/store/final_vote.hpp>
 #include <nano/store/online_weight.hpp>
 #include <nano/store/peer.hpp>
@@ -24,6 +26,7 @@
 #include <nano/store/rep_weight.hpp>
 #include <nano/store/version.hpp>
 
+#include <algorithm>
 #include <stack>
 
 #include <cryptopp/words.h>
@@ -62,6 +65,7 @@ public:
 			nano::account_info new_info (block_a.hashables.previous, info->representative, info->open_block, ledger.any.block_balance (transaction, block_a.hashables.previous).value (), nano::seconds_since_epoch (), info->block_count - 1, nano::epoch::epoch_0);
 			ledger.update_account (transaction, pending.value ().source, *info, new_info);
 			ledger.store.block.del (transaction, hash);
+			ledger.block_cache.erase (hash);
 			ledger.store.block.successor_clear (transaction, block_a.hashables.previous);
 			ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::send);
 		}
@@ -79,6 +83,7 @@ public:
 		nano::account_info new_info (block_a.hashables.previous, info->representative, info->open_block, ledger.any.block_balance (transaction, block_a.hashables.previous).value (), nano::seconds_since_epoch (), info->block_count - 1, nano::epoch::epoch_0);
 		ledger.update_account (transaction, destination_account, *info, new_info);
 		ledger.store.block.del (transaction, hash);
+		ledger.block_cache.erase (hash);
 		ledger.store.pending.put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account.value_or (0), amount, nano::epoch::epoch_0 });
 		ledger.store.block.successor_clear (transaction, block_a.hashables.previous);
 		ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::receive);
@@ -93,6 +98,7 @@ public:
 		nano::account_info new_info;
 		ledger.update_account (transaction, destination_account, new_info, new_info);
 		ledger.store.block.del (transaction, hash);
+		ledger.block_cache.erase (hash);
 		ledger.store.pending.put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account.value_or (0), amount, nano::epoch::epoch_0 });
 		ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::open);
 	}
@@ -109,6 +115,7 @@ public:
 		auto representative = block->representative_field ().value ();
 		ledger.cache.rep_weights.representation_add_dual (transaction, block_a.hashables.representative, 0 - balance.number (), representative, balance.number ());
 		ledger.store.block.del (transaction, hash);
+		ledger.block_cache.erase (hash);
 		nano::account_info new_info (block_a.hashables.previous, representative, info->open_block, info->balance, nano::seconds_since_epoch (), info->block_count - 1, nano::epoch::epoch_0);
 		ledger.update_account (transaction, account, *info, new_info);
 		ledger.store.block.successor_clear (transaction, block_a.hashables.previous);
@@ -176,6 +183,7 @@ public:
 			ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::open);
 		}
 		ledger.store.block.del (transaction, hash);
+		ledger.block_cache.erase (hash);
 	}
 	nano::secure::write_transaction const & transaction;
 	nano::ledger & ledger;
@@ -186,7 +194,7 @@ public:
 class ledger_processor : public nano::mutable_block_visitor
 {
 public:
-	ledger_processor (nano::ledger &, nano::secure::write_transaction const &);
+	ledger_processor (nano::ledger &, nano::secure::write_transaction const &, std::optional<nano::public_key> const & verified_signer = std::nullopt);
 	virtual ~ledger_processor () = default;
 	void send_block (nano::send_block &) override;
 	void receive_block (nano::receive_block &) override;
@@ -201,8 +209,22 @@ public:
 
 private:
 	bool validate_epoch_block (nano::state_block const & block_a);
+	// Same as `nano::validate_message`, but skips verification if the signature was already verified with it for this signer
+	// Any other signer (e.g. an epoch signer the pre-verification did not expect) falls back to `nano::validate_message`
+	bool validate_signature (nano::public_key const & signer, nano::block_hash const & hash, nano::signature const & signature) const;
+
+	std::optional<nano::public_key> const verified_signer;
 };
 
+bool ledger_processor::validate_signature (nano::public_key const & signer, nano::block_hash const & hash, nano::signature const & signature) const
+{
+	if (verified_signer && *verified_signer == signer)
+	{
+		return false; // Valid
+	}
+	return validate_message (signer, hash, signature);
+}
+
 // Returns true if this block which has an epoch link is correctly formed.
 bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 {
@@ -218,10 +240,10 @@ bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 		else
 		{
 			// Check for possible regular state blocks with epoch link (send subtype)
-			if (validate_message (block_a.hashables.account, block_a.hash (), block_a.signature))
+			if (validate_signature (block_a.hashables.account, block_a.hash (), block_a.signature))
 			{
 				// Is epoch block signed correctly
-				if (validate_message (ledger.epoch_signer (block_a.link_field ().value ()), block_a.hash (), block_a.signature))
+				if (validate_signature (ledger.epoch_signer (block_a.link_field ().value ()), block_a.hash (), block_a.signature))
 				{
 					result = nano::block_status::bad_signature;
 				}
@@ -261,7 +283,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = validate_signature (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -377,7 +399,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = validate_signature (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature));
@@ -459,7 +481,7 @@ void ledger_processor::change_block (nano::change_block & block_a)
 				if (result == nano::block_status::progress)
 				{
 					debug_assert (info->head == block_a.hashables.previous);
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = validate_signature (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
@@ -502,7 +524,7 @@ void ledger_processor::send_block (nano::send_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress;
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = validate_signature (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
@@ -551,7 +573,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress; // If we have the block but it's not the latest we have a signed fork (Malicious)
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+					result = validate_signature (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						debug_assert (!validate_message (account, hash, block_a.signature));
@@ -600,7 +622,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block already? (Harmless)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+		result = validate_signature (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -643,9 +665,10 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	}
 }
 
-ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a) :
+ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a, std::optional<nano::public_key> const & verified_signer_a) :
 	ledger (ledger_a),
-	transaction (transaction_a)
+	transaction (transaction_a),
+	verified_signer (verified_signer_a)
 {
 }
 
@@ -711,16 +734,68 @@ void representative_visitor::state_block (nano::state_block const & block_a)
 {
 	result = block_a.hash ();
 }
+
+/**
+ * Logs progress and throughput of the table scans done while initializing the ledger cache
+ * Traversal threads report processed entries in chunks to avoid contending on the shared counter
+ */
+class scan_progress
+{
+public:
+	static uint64_t constexpr chunk_size = 64 * 1024;
+	static uint64_t constexpr log_interval = 1024 * 1024;
+
+	scan_progress (nano::logger & logger_a, std::string table_a) :
+		logger{ logger_a },
+		table{ std::move (table_a) }
+	{
+		logger.info (nano::log::type::ledger, "Scanning {} to initialize ledger cache...", table);
+	}
+
+	void add (uint64_t count)
+	{
+		auto const before = processed.fetch_add (count);
+		auto const after = before + count;
+		if (before / log_interval != after / log_interval)
+		{
+			logger.info (nano::log::type::ledger, "Scanned {} {} ({} per second)", after, table, rate (after));
+		}
+	}
+
+	void finish ()
+	{
+		logger.info (nano::log::type::ledger, "Finished scanning {} {} in {} ms ({} per second)", processed.load (), table, elapsed ().count (), rate (processed));
+	}
+
+private:
+	std::chrono::milliseconds elapsed () const
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start);
+	}
+
+	uint64_t rate (uint64_t count) const
+	{
+		auto const elapsed_l = elapsed ().count ();
+		return elapsed_l > 0 ? count * 1000 / elapsed_l : count;
+	}
+
+	nano::logger & logger;
+	std::string const table;
+	std::atomic<uint64_t> processed{ 0 };
+	std::chrono::steady_clock::time_point const start{ std::chrono::steady_clock::now () };
+};
 } // namespace
 
-nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a) :
+nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a, nano::block_cache_config const & block_cache_config_a) :
 	constants{ constants },
 	store{ store_a },
 	cache{ store_a.rep_weight, min_rep_weight_a },
 	stats{ stat_a },
 	check_bootstrap_weights{ true },
+	block_cache_impl{ std::make_unique<nano::block_cache> (block_cache_config_a, store_a.block, stat_a) },
 	any_impl{ std::make_unique<ledger_set_any> (*this) },
 	confirmed_impl{ std::make_unique<ledger_set_confirmed> (*this) },
+	block_cache{ *block_cache_impl },
 	any{ *any_impl },
 	confirmed{ *confirmed_impl }
 {
@@ -738,7 +813,13 @@ auto nano::ledger::tx_begin_write (nano::store::writer guard_type) const -> secu
 {
 	auto guard = store.write_queue.wait (guard_type);
 	auto txn = store.tx_begin_write ();
-	return secure::write_transaction{ std::move (txn), std::move (guard) };
+	secure::write_transaction result{ std::move (txn), std::move (guard) };
+	// Persisted cache counts become stale once the ledger is modified
+	if (cache_snapshot_exists.exchange (false))
+	{
+		store.version.cache_del (result);
+	}
+	return result;
 }
 
 auto nano::ledger::tx_begin_read () const -> secure::read_transaction
@@ -748,22 +829,62 @@ auto nano::ledger::tx_begin_read () const -> secure::read_transaction
 
 void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache_flags_a)
 {
-	if (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count)
+	auto & logger = nano::default_logger ();
+
+	// Counts persisted on the last clean shutdown, removed by the first write transaction
+	std::optional<nano::store::cache_snapshot> snapshot;
 	{
+		auto transaction (store.tx_begin_read ());
+		snapshot = store.version.cache_get (transaction);
+		cache_snapshot_exists = snapshot.has_value ();
+		// Snapshots are only trusted when taken by the same node version on the same store schema, and when they agree with the ledger
+		if (snapshot && (snapshot->store_version != store.version.get (transaction) || snapshot->node_major_version != nano::get_major_node_version () || snapshot->node_minor_version != nano::get_minor_node_version ()))
+		{
+			logger.warn (nano::log::type::ledger, "Ignoring ledger cache snapshot from another version (store: {}, node: {}.{})", snapshot->store_version, snapshot->node_major_version, snapshot->node_minor_version);
+			snapshot = std::nullopt;
+		}
+		if (snapshot && (!snapshot->valid () || snapshot->pruned_count != store.pruned.count (transaction)))
+		{
+			logger.warn (nano::log::type::ledger, "Ignoring inconsistent ledger cache snapshot (blocks: {}, accounts: {}, cemented: {}, pruned: {})", snapshot->block_count, snapshot->account_count, snapshot->cemented_count, snapshot->pruned_count);
+			snapshot = std::nullopt;
+		}
+	}
+
+	if (snapshot)
+	{
+		logger.info (nano::log::type::ledger, "Using ledger cache snapshot from last shutdown (blocks: {}, accounts: {}, cemented: {})", snapshot->block_count, snapshot->account_count, snapshot->cemented_count);
+
+		cache.block_count = snapshot->block_count;
+		cache.account_count = snapshot->account_count;
+		cache.cemented_count = snapshot->cemented_count;
+		cache.pruned_count = snapshot->pruned_count;
+	}
+
+	if (!snapshot && (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count))
+	{
+		scan_progress progress{ logger, "accounts" };
 		store.account.for_each_par (
-		[this] (store::read_transaction const & /*unused*/, auto i, auto n) {
+		[this, &progress] (store::read_transaction const & /*unused*/, auto i, auto n) {
 			uint64_t block_count_l{ 0 };
 			uint64_t account_count_l{ 0 };
 			for (; i != n; ++i)
 			{
 				nano::account_info const & info (i->second);
 				block_count_l += info.block_count;
-				++account_count_l;
+				if (++account_count_l % progress.chunk_size == 0)
+				{
+					progress.add (progress.chunk_size);
+				}
 			}
+			progress.add (account_count_l % progress.chunk_size);
 			this->cache.block_count += block_count_l;
 			this->cache.account_count += account_count_l;
 		});
+		progress.finish ();
+	}
 
+	if (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count)
+	{
 		store.rep_weight.for_each_par (
 		[this] (store::read_transaction const & /*unused*/, auto i, auto n) {
 			nano::rep_weights rep_weights_l{ this->store.rep_weight };
@@ -775,21 +896,61 @@ void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache
 		});
 	}
 
-	if (generate_cache_flags_a.cemented_count)
+	if (!snapshot && generate_cache_flags_a.cemented_count)
 	{
+		scan_progress progress{ logger, "confirmation heights" };
 		store.confirmation_height.for_each_par (
-		[this] (store::read_transaction const & /*unused*/, auto i, auto n) {
+		[this, &progress] (store::read_transaction const & /*unused*/, auto i, auto n) {
 			uint64_t cemented_count_l (0);
+			uint64_t processed_l (0);
 			for (; i != n; ++i)
 			{
 				cemented_count_l += i->second.height;
+				if (++processed_l % progress.chunk_size == 0)
+				{
+					progress.add (progress.chunk_size);
+				}
 			}
+			progress.add (processed_l % progress.chunk_size);
 			this->cache.cemented_count += cemented_count_l;
 		});
+		progress.finish ();
+	}
+
+	if (!snapshot)
+	{
+		auto transaction (store.tx_begin_read ());
+		cache.pruned_count = store.pruned.count (transaction);
+	}
+
+	cache_counts_complete = snapshot || (generate_cache_flags_a.account_count && generate_cache_flags_a.block_count && generate_cache_flags_a.cemented_count);
+}
+
+void nano::ledger::cache_snapshot_put ()
+{
+	// Counts that were not generated at startup are incomplete and must not be persisted
+	if (!cache_counts_complete)
+	{
+		return;
 	}
 
-	auto transaction (store.tx_begin_read ());
-	cache.pruned_count = store.pruned.count (transaction);
+	auto transaction = tx_begin_write ();
+
+	nano::store::cache_snapshot snapshot;
+	snapshot.store_version = store.version.get (transaction);
+	snapshot.node_major_version = nano::get_major_node_version ();
+	snapshot.node_minor_version = nano::get_minor_node_version ();
+	snapshot.block_count = cache.block_count;
+	snapshot.account_count = cache.account_count;
+	snapshot.cemented_count = cache.cemented_count;
+	snapshot.pruned_count = cache.pruned_count;
+	store.version.cache_put (transaction, snapshot);
+}
+
+void nano::ledger::cache_snapshot_del ()
+{
+	auto transaction = tx_begin_write ();
+	store.version.cache_del (transaction);
 }
 
 bool nano::ledger::unconfirmed_exists (secure::transaction const & transaction, nano::block_hash const & hash)
@@ -888,6 +1049,116 @@ std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm (secure::write_tr
 	return result;
 }
 
+std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm_plan (secure::transaction const & transaction, nano::block_hash const & target_hash, std::unordered_set<nano::block_hash> & planned, size_t max_blocks) const
+{
+	std::deque<std::shared_ptr<nano::block>> result;
+
+	auto is_confirmed = [&] (nano::block_hash const & hash) {
+		return planned.contains (hash) || confirmed.block_exists_or_pruned (transaction, hash);
+	};
+
+	// Same traversal as `confirm`, planned blocks take the place of blocks confirmed in the write transaction
+	std::deque<nano::block_hash> stack;
+	stack.push_back (target_hash);
+	while (!stack.empty ())
+	{
+		auto hash = stack.back ();
+		auto block = any.block_get (transaction, hash);
+		if (!block)
+		{
+			break; // Block was rolled back
+		}
+
+		auto dependents = dependent_blocks (transaction, *block);
+		for (auto const & dependent : dependents)
+		{
+			if (!dependent.is_zero () && !is_confirmed (dependent))
+			{
+				stack.push_back (dependent);
+
+				// Limit the stack size to avoid excessive memory usage
+				// This will forget the bottom of the dependency tree
+				if (stack.size () > max_blocks)
+				{
+					stack.pop_front ();
+				}
+			}
+		}
+
+		if (stack.back () == hash)
+		{
+			stack.pop_back ();
+			if (!is_confirmed (hash))
+			{
+				planned.insert (hash);
+				result.push_back (block);
+			}
+		}
+
+		// Early return might leave parts of the dependency tree unplanned
+		if (result.size () >= max_blocks)
+		{
+			break;
+		}
+	}
+
+	return result;
+}
+
+std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm_planned (secure::write_transaction & transaction, std::deque<std::shared_ptr<nano::block>> const & plan)
+{
+	std::deque<std::shared_ptr<nano::block>> result;
+
+	// Confirmation height updates are collected and only the final height of each account is written
+	std::unordered_map<nano::account, nano::confirmation_height_info> heights;
+	auto confirmed_height = [&] (nano::account const & account) -> uint64_t {
+		if (auto existing = heights.find (account); existing != heights.end ())
+		{
+			return existing->second.height;
+		}
+		auto info = store.confirmation_height.get (transaction, account);
+		return info ? info->height : 0;
+	};
+
+	// Plans omit dependencies listed by other plans computed with the same planned set, those plans might not have been applied
+	std::unordered_set<nano::block_hash> confirmed_here;
+	auto dependencies_confirmed = [&] (nano::block const & block) {
+		auto dependents = dependent_blocks (transaction, block);
+		return std::all_of (dependents.begin (), dependents.end (), [&] (nano::block_hash const & dependent) {
+			return dependent.is_zero () || confirmed_here.contains (dependent) || confirmed.block_exists_or_pruned (transaction, dependent);
+		});
+	};
+
+	for (auto const & block : plan)
+	{
+		auto const account = block->account ();
+		auto const height = confirmed_height (account);
+		if (height >= block->sideband ().height)
+		{
+			continue; // Already confirmed
+		}
+		// The plan might have been computed on an older snapshot of the ledger
+		// Plans list dependencies first, so later blocks can't be confirmed either once a block fails the checks
+		if (height + 1 != block->sideband ().height || !store.block.exists (transaction, block->hash ()) || !dependencies_confirmed (*block))
+		{
+			stats.inc (nano::stat::type::confirmation_height, nano::stat::detail::plan_invalid);
+			break;
+		}
+		heights[account] = nano::confirmation_height_info{ block->sideband ().height, block->hash () };
+		confirmed_here.insert (block->hash ());
+		result.push_back (block);
+	}
+
+	for (auto const & [account, info] : heights)
+	{
+		store.confirmation_height.put (transaction, account, info);
+	}
+	cache.cemented_count += result.size ();
+
+	stats.add (nano::stat::type::confirmation_height, nano::stat::detail::blocks_confirmed, result.size ());
+	return result;
+}
+
 void nano::ledger::confirm_one (secure::write_transaction & transaction, nano::block const & block)
 {
 	debug_assert ((!store.confirmation_height.get (transaction, block.account ()) && block.sideband ().height == 1) || store.confirmation_height.get (transaction, block.account ()).value ().height + 1 == block.sideband ().height);
@@ -898,10 +1169,10 @@ void nano::ledger::confirm_one (secure::write_transaction & transaction, nano::b
 	stats.inc (nano::stat::type::confirmation_height, nano::stat::detail::blocks_confirmed);
 }
 
-nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a)
+nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a, std::optional<nano::public_key> const & verified_signer)
 {
 	debug_assert (!constants.work.validate_entry (*block_a) || constants.genesis == nano::dev::genesis);
-	ledger_processor processor (*this, transaction_a);
+	ledger_processor processor (*this, transaction_a, verified_signer);
 	block_a->visit (processor);
 	if (processor.result == nano::block_status::progress)
 	{
@@ -1202,6 +1473,25 @@ void nano::ledger::update_account (secure::write_transaction const & transaction
 		debug_assert (cache.account_count > 0);
 		--cache.account_count;
 	}
+	update_delegator (transaction_a, account_a, old_a, new_a);
+}
+
+void nano::ledger::update_delegator (secure::write_transaction const & transaction_a, nano::account const & account_a, nano::account_info const & old_a, nano::account_info const & new_a)
+{
+	// An empty head means the account doesn't exist (yet or anymore)
+	auto const old_representative = old_a.head.is_zero () ? std::nullopt : std::make_optional (old_a.representative);
+	auto const new_representative = new_a.head.is_zero () ? std::nullopt : std::make_optional (new_a.representative);
+	if (old_representative != new_representative)
+	{
+		if (old_representative)
+		{
+			store.delegator.del (transaction_a, *old_representative, account_a);
+		}
+		if (new_representative)
+		{
+			store.delegator.put (transaction_a, *new_representative, account_a);
+		}
+	}
 }
 
 std::shared_ptr<nano::block> nano::ledger::forked_block (secure::transaction const & transaction_a, nano::block const & block_a)
@@ -1236,6 +1526,7 @@ uint64_t nano::ledger::pruning_action (secure::write_transaction & transaction_a
 		{
 			release_assert (confirmed.block_exists (transaction_a, hash));
 			store.block.del (transaction_a, hash);
+			block_cache.erase (hash);
 			store.pruned.put (transaction_a, hash);
 			hash = block_l->previous ();
 			++pruned_count;
@@ -1380,6 +1671,7 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 			{
 				rocksdb_transaction.refresh_if_needed ();
 				rocksdb_store->account.put (rocksdb_transaction, i->first, i->second);
+				rocksdb_store->delegator.put (rocksdb_transaction, i->second.representative, i->first);
 				if (auto count_l = ++count; count_l % 500000 == 0)
 				{
 					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
@@ -1554,5 +1846,6 @@ nano::container_info nano::ledger::container_info () const
 	nano::container_info info;
 	info.put ("bootstrap_weights", bootstrap_weights);
 	info.add ("rep_weights", cache.rep_weights.container_info ());
+	info.add ("block_cache", block_cache.container_info ());
 	return info;
 }
@@ -3,6 +3,7 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/secure/account_info.hpp>
+#include <nano/secure/block_cache.hpp>
 #include <nano/secure/generate_cache_flags.hpp>
 #include <nano/secure/ledger_cache.hpp>
 #include <nano/secure/pending_info.hpp>
@@ -11,6 +12,8 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <optional>
+#include <unordered_set>
 
 namespace nano::store
 {
@@ -35,7 +38,7 @@ class ledger final
 	friend class receivable_iterator;
 
 public:
-	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0);
+	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0, nano::block_cache_config const & = nano::block_cache_config{});
 	~ledger ();
 
 	/** Start read-write transaction */
@@ -62,7 +65,24 @@ public:
 	std::deque<std::shared_ptr<nano::block>> random_blocks (secure::transaction const &, size_t count) const;
 	std::optional<nano::pending_info> pending_info (secure::transaction const &, nano::pending_key const & key) const;
 	std::deque<std::shared_ptr<nano::block>> confirm (secure::write_transaction &, nano::block_hash const & hash, size_t max_blocks = 1024 * 128);
-	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block);
+	/**
+	 * Computes which blocks need to be confirmed to confirm `hash`, in the order `confirm` would confirm them, without modifying the ledger
+	 * Blocks already in `planned` are treated as confirmed and newly planned blocks are added to it, so a set can be shared between multiple targets
+	 * Only needs a read transaction, so plans can be computed in parallel and applied later with `confirm_planned`
+	 */
+	std::deque<std::shared_ptr<nano::block>> confirm_plan (secure::transaction const &, nano::block_hash const & hash, std::unordered_set<nano::block_hash> & planned, size_t max_blocks = 1024 * 128) const;
+	/**
+	 * Confirms blocks from a plan computed by `confirm_plan`, confirmation heights are written once per account
+	 * Blocks that are already confirmed are skipped, applying stops at the first block that doesn't directly follow the confirmed frontier of its account or no longer exists
+	 * @returns newly confirmed blocks
+	 */
+	std::deque<std::shared_ptr<nano::block>> confirm_planned (secure::write_transaction &, std::deque<std::shared_ptr<nano::block>> const & plan);
+	/**
+	 * Processes the block, inserting it into the ledger if it's valid
+	 * @param verified_signer If set, block signature was already verified with `validate_message` to be valid for this key and will not be checked again
+	 * Results of batch verification must not be passed here, they can differ from `validate_message` for malformed signatures
+	 */
+	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block, std::optional<nano::public_key> const & verified_signer = std::nullopt);
 	bool rollback (secure::write_transaction const &, nano::block_hash const &, std::deque<std::shared_ptr<nano::block>> & rollback_list);
 	bool rollback (secure::write_transaction const &, nano::block_hash const &);
 	void update_account (secure::write_transaction const &, nano::account const &, nano::account_info const &, nano::account_info const &);
@@ -71,6 +91,12 @@ public:
 	bool dependents_confirmed (secure::transaction const &, nano::block const &) const;
 	bool is_epoch_link (nano::link const &) const;
 	std::array<nano::block_hash, 2> dependent_blocks (secure::transaction const &, nano::block const &) const;
+	/**
+	 * Persists ledger cache counts so the next startup can skip scanning the ledger, must only be called once nothing modifies the ledger anymore
+	 * The snapshot is removed by the first write transaction after startup, so it's only ever used after a clean shutdown
+	 */
+	void cache_snapshot_put ();
+	void cache_snapshot_del ();
 	std::shared_ptr<nano::block> find_receive_block_by_send_hash (secure::transaction const &, nano::account const & destination, nano::block_hash const & send_block_hash);
 	nano::account const & epoch_signer (nano::link const &) const;
 	nano::link const & epoch_link (nano::epoch) const;
@@ -110,11 +136,19 @@ public:
 private:
 	void initialize (nano::generate_cache_flags const &);
 	void confirm_one (secure::write_transaction &, nano::block const & block);
+	// Keeps the representative -> account index in sync with account changes
+	void update_delegator (secure::write_transaction const &, nano::account const &, nano::account_info const & old_info, nano::account_info const & new_info);
+
+	// Set when all cached counts were computed during initialization, only then can they be persisted
+	bool cache_counts_complete{ false };
+	mutable std::atomic<bool> cache_snapshot_exists{ false };
 
+	std::unique_ptr<nano::block_cache> block_cache_impl;
 	std::unique_ptr<ledger_set_any> any_impl;
 	std::unique_ptr<ledger_set_confirmed> confirmed_impl;
 
 public:
+	nano::block_cache & block_cache;
 	ledger_set_any & any;
 	ledger_set_confirmed & confirmed;
 };
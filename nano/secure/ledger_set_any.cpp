@@ -35,6 +35,11 @@ std::optional<nano::account_info> nano::ledger_set_any::account_get (secure::tra
 	return ledger.store.account.get (transaction, account);
 }
 
+std::vector<std::optional<nano::account_info>> nano::ledger_set_any::account_get (secure::transaction const & transaction, std::vector<nano::account> const & accounts) const
+{
+	return ledger.store.account.get_multiple (transaction, accounts);
+}
+
 nano::block_hash nano::ledger_set_any::account_head (secure::transaction const & transaction, nano::account const & account) const
 {
 	auto info = account_get (transaction, account);
@@ -149,7 +154,13 @@ std::shared_ptr<nano::block> nano::ledger_set_any::block_get (secure::transactio
 	{
 		return nullptr;
 	}
-	return ledger.store.block.get (transaction, hash);
+	return ledger.block_cache.get (transaction, hash);
+}
+
+std::vector<std::shared_ptr<nano::block>> nano::ledger_set_any::block_get (secure::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const
+{
+	// Bypasses the block cache, batches are mostly requested by RPC clients and would evict blocks in use by the node
+	return ledger.store.block.get_multiple (transaction, hashes);
 }
 
 uint64_t nano::ledger_set_any::block_height (secure::transaction const & transaction, nano::block_hash const & hash) const
@@ -227,3 +238,8 @@ std::optional<nano::pending_info> nano::ledger_set_any::pending_get (secure::tra
 {
 	return ledger.store.pending.get (transaction, key);
 }
+
+std::vector<std::optional<nano::pending_info>> nano::ledger_set_any::pending_get (secure::transaction const & transaction, std::vector<nano::pending_key> const & keys) const
+{
+	return ledger.store.pending.get_multiple (transaction, keys);
+}
@@ -35,6 +35,8 @@ public: // Operations on accounts
 	account_iterator account_begin (secure::transaction const & transaction) const;
 	account_iterator account_end () const;
 	std::optional<nano::account_info> account_get (secure::transaction const & transaction, nano::account const & account) const;
+	// Batched lookup of many accounts, results are in the same order as the input
+	std::vector<std::optional<nano::account_info>> account_get (secure::transaction const & transaction, std::vector<nano::account> const & accounts) const;
 	nano::block_hash account_head (secure::transaction const & transaction, nano::account const & account) const;
 	uint64_t account_height (secure::transaction const & transaction, nano::account const & account) const;
 	// Returns the next account entry equal or greater than 'account'
@@ -53,12 +55,16 @@ public: // Operations on blocks
 	bool block_exists (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	bool block_exists_or_pruned (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	std::shared_ptr<nano::block> block_get (secure::transaction const & transaction, nano::block_hash const & hash) const;
+	// Batched lookup of many blocks, results are in the same order as the input
+	std::vector<std::shared_ptr<nano::block>> block_get (secure::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const;
 	uint64_t block_height (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	std::optional<nano::block_hash> block_successor (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	std::optional<nano::block_hash> block_successor (secure::transaction const & transaction, nano::qualified_root const & root) const;
 
 public: // Operations on pending entries
 	std::optional<nano::pending_info> pending_get (secure::transaction const & transaction, nano::pending_key const & key) const;
+	// Batched lookup of many pending entries, results are in the same order as the input
+	std::vector<std::optional<nano::pending_info>> pending_get (secure::transaction const & transaction, std::vector<nano::pending_key> const & keys) const;
 	receivable_iterator receivable_end () const;
 	bool receivable_exists (secure::transaction const & transaction, nano::account const & account) const;
 	// Returns the next receivable entry equal or greater than 'key'
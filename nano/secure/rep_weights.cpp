@@ -3,18 +3,196 @@
 #include <nano/store/component.hpp>
 #include <nano/store/rep_weight.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Open addressing table with linear probing
+ * Slots are never removed, representatives that lose their weight keep their slot with a zero weight, so readers can probe without synchronizing with writers
+ * Weights are updated in place, each slot is protected by a sequence lock
+ */
+class nano::rep_weights::table
+{
+public:
+	struct alignas (64) slot
+	{
+		std::atomic<bool> occupied{ false };
+		nano::account account{};
+		std::atomic<uint64_t> sequence{ 0 };
+		std::atomic<uint64_t> high{ 0 };
+		std::atomic<uint64_t> low{ 0 };
+
+		nano::uint128_t load () const
+		{
+			while (true)
+			{
+				auto const sequence_l = sequence.load (std::memory_order_acquire);
+				if (sequence_l % 2 == 0)
+				{
+					auto const high_l = high.load (std::memory_order_relaxed);
+					auto const low_l = low.load (std::memory_order_relaxed);
+					std::atomic_thread_fence (std::memory_order_acquire);
+					if (sequence.load (std::memory_order_relaxed) == sequence_l)
+					{
+						return (nano::uint128_t{ high_l } << 64) | low_l;
+					}
+				}
+				// Writer is updating the weight
+				std::this_thread::yield ();
+			}
+		}
+
+		// Single writer only
+		void store (nano::uint128_t const & weight)
+		{
+			auto const sequence_l = sequence.load (std::memory_order_relaxed);
+			sequence.store (sequence_l + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence (std::memory_order_release);
+			high.store (static_cast<uint64_t> (weight >> 64), std::memory_order_relaxed);
+			low.store (static_cast<uint64_t> (weight), std::memory_order_relaxed);
+			sequence.store (sequence_l + 2, std::memory_order_release);
+		}
+	};
+
+	explicit table (size_t capacity) :
+		slots (capacity),
+		mask{ capacity - 1 }
+	{
+		debug_assert (std::has_single_bit (capacity));
+	}
+
+	slot const * find (nano::account const & account) const
+	{
+		for (auto index = start (account);; index = (index + 1) & mask)
+		{
+			auto const & slot = slots[index];
+			if (!slot.occupied.load (std::memory_order_acquire))
+			{
+				return nullptr;
+			}
+			if (slot.account == account)
+			{
+				return &slot;
+			}
+		}
+	}
+
+	slot * find (nano::account const & account)
+	{
+		return const_cast<slot *> (std::as_const (*this).find (account));
+	}
+
+	// Single writer only, the table must have a free slot
+	slot & insert (nano::account const & account, nano::uint128_t const & weight)
+	{
+		debug_assert (used < slots.size ());
+		for (auto index = start (account);; index = (index + 1) & mask)
+		{
+			auto & slot = slots[index];
+			if (!slot.occupied.load (std::memory_order_relaxed))
+			{
+				slot.account = account;
+				slot.store (weight);
+				// Publish the slot only once it's fully initialized
+				slot.occupied.store (true, std::memory_order_release);
+				++used;
+				return slot;
+			}
+			debug_assert (slot.account != account);
+		}
+	}
+
+	size_t capacity () const
+	{
+		return slots.size ();
+	}
+
+	// Keep probe sequences short by growing at half capacity
+	bool full () const
+	{
+		return (used + 1) * 2 > slots.size ();
+	}
+
+	template <typename Func>
+	void for_each (Func const & func) const
+	{
+		for (auto const & slot : slots)
+		{
+			if (slot.occupied.load (std::memory_order_acquire))
+			{
+				if (auto weight = slot.load (); !weight.is_zero ())
+				{
+					func (slot.account, weight);
+				}
+			}
+		}
+	}
+
+	size_t used{ 0 };
+
+private:
+	size_t start (nano::account const & account) const
+	{
+		// Accounts are usually random public keys, the finalizer spreads low entropy keys (eg. small numbers in tests, which only fill the high bytes of a word) over all bits
+		auto hash = account.qwords[0] ^ account.qwords[1] ^ account.qwords[2] ^ account.qwords[3];
+		hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+		hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+		return (hash ^ (hash >> 31)) & mask;
+	}
+
+	std::vector<slot> slots;
+	size_t const mask;
+};
+
+/**
+ * Registers the calling thread as a reader for the epoch current at construction
+ */
+class nano::rep_weights::read_guard
+{
+public:
+	explicit read_guard (nano::rep_weights const & weights) :
+		active{ weights.readers[shard ()].active[weights.read_epoch.load () % 2] }
+	{
+		active.fetch_add (1);
+	}
+
+	~read_guard ()
+	{
+		active.fetch_sub (1);
+	}
+
+private:
+	static size_t shard ()
+	{
+		static thread_local size_t const result = std::hash<std::thread::id>{}(std::this_thread::get_id ()) % reader_shards;
+		return result;
+	}
+
+	std::atomic<uint64_t> & active;
+};
+
 nano::rep_weights::rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a) :
+	table_impl{ std::make_unique<table> (initial_capacity) },
+	current{ table_impl.get () },
 	rep_weight_store{ rep_weight_store_a },
 	min_weight{ min_weight_a }
 {
 }
 
+nano::rep_weights::~rep_weights ()
+{
+}
+
 void nano::rep_weights::representation_add (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & amount_a)
 {
 	auto previous_weight{ rep_weight_store.get (txn_a, rep_a) };
 	auto new_weight = previous_weight + amount_a;
 	put_store (txn_a, rep_a, previous_weight, new_weight);
-	std::unique_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
 	put_cache (rep_a, new_weight);
 }
 
@@ -28,7 +206,7 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 		auto new_weight_2 = previous_weight_2 + amount_2;
 		put_store (txn_a, rep_1, previous_weight_1, new_weight_1);
 		put_store (txn_a, rep_2, previous_weight_2, new_weight_2);
-		std::unique_lock guard{ mutex };
+		std::lock_guard guard{ mutex };
 		put_cache (rep_1, new_weight_1);
 		put_cache (rep_2, new_weight_2);
 	}
@@ -40,54 +218,94 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 
 void nano::rep_weights::representation_put (nano::account const & account_a, nano::uint128_t const & representation_a)
 {
-	std::unique_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
 	put_cache (account_a, representation_a);
 }
 
 nano::uint128_t nano::rep_weights::representation_get (nano::account const & account_a) const
 {
-	std::shared_lock lk{ mutex };
 	return get (account_a);
 }
 
 /** Makes a copy */
 std::unordered_map<nano::account, nano::uint128_t> nano::rep_weights::get_rep_amounts () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts;
+	std::unordered_map<nano::account, nano::uint128_t> result;
+	read_guard guard{ *this };
+	current.load ()->for_each ([&result] (nano::account const & account, nano::uint128_t const & weight) {
+		result.emplace (account, weight);
+	});
+	return result;
 }
 
 void nano::rep_weights::copy_from (nano::rep_weights & other_a)
 {
-	std::unique_lock guard_this{ mutex };
-	std::shared_lock guard_other{ other_a.mutex };
-	for (auto const & entry : other_a.rep_amounts)
-	{
-		auto prev_amount (get (entry.first));
-		put_cache (entry.first, prev_amount + entry.second);
-	}
+	std::scoped_lock guard{ mutex, other_a.mutex };
+	other_a.current.load ()->for_each ([this] (nano::account const & account, nano::uint128_t const & weight) {
+		put_cache (account, get (account) + weight);
+	});
 }
 
 void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_union const & representation_a)
 {
-	auto it = rep_amounts.find (account_a);
-	if (representation_a < min_weight || representation_a.is_zero ())
+	// Weights below the minimum are not cached
+	nano::uint128_t weight{ 0 };
+	if (!(representation_a < min_weight || representation_a.is_zero ()))
+	{
+		weight = representation_a.number ();
+	}
+
+	auto * table_l = current.load (std::memory_order_relaxed);
+	if (auto * slot = table_l->find (account_a))
 	{
-		if (it != rep_amounts.end ())
+		auto const previous = slot->load ();
+		slot->store (weight);
+		if (previous.is_zero () != weight.is_zero ())
 		{
-			rep_amounts.erase (it);
+			weight.is_zero () ? --count : ++count;
 		}
 	}
-	else
+	else if (!weight.is_zero ())
 	{
-		auto amount = representation_a.number ();
-		if (it != rep_amounts.end ())
+		if (table_l->full ())
 		{
-			it->second = amount;
+			table_l = &grow ();
 		}
-		else
+		table_l->insert (account_a, weight);
+		++count;
+	}
+}
+
+auto nano::rep_weights::grow () -> table &
+{
+	auto const & old_table = *table_impl;
+	// Slots of representatives without weight are dropped when moving to the new table, so it's sized for the representatives that still have weight
+	// Filling a quarter of the new table leaves room to double the number of representatives before it's replaced again
+	auto const capacity = std::max (initial_capacity, std::bit_ceil ((count.load () + 1) * 4));
+	auto new_table = std::make_unique<table> (capacity);
+	old_table.for_each ([&new_table] (nano::account const & account, nano::uint128_t const & weight) {
+		new_table->insert (account, weight);
+	});
+
+	current.store (new_table.get ());
+	// Readers might still be using the old table
+	synchronize ();
+	table_impl = std::move (new_table);
+	return *table_impl;
+}
+
+void nano::rep_weights::synchronize () const
+{
+	// Readers that loaded the epoch just before the first flip might register in the counter of the next epoch, the second flip waits for those
+	for (int i = 0; i < 2; ++i)
+	{
+		auto const previous = read_epoch.fetch_add (1) % 2;
+		for (auto const & shard : readers)
 		{
-			rep_amounts.emplace (account_a, amount);
+			while (shard.active[previous].load () != 0)
+			{
+				std::this_thread::yield ();
+			}
 		}
 	}
 }
@@ -109,28 +327,25 @@ void nano::rep_weights::put_store (store::write_transaction const & txn_a, nano:
 
 nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
 {
-	auto it = rep_amounts.find (account_a);
-	if (it != rep_amounts.end ())
-	{
-		return it->second;
-	}
-	else
+	read_guard guard{ *this };
+	if (auto const * slot = current.load ()->find (account_a))
 	{
-		return nano::uint128_t{ 0 };
+		return slot->load ();
 	}
+	return nano::uint128_t{ 0 };
 }
 
 std::size_t nano::rep_weights::size () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts.size ();
+	return count.load ();
 }
 
 nano::container_info nano::rep_weights::container_info () const
 {
-	std::shared_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
 
 	nano::container_info info;
-	info.put ("rep_amounts", rep_amounts);
+	info.put ("rep_amounts", count.load (), sizeof (table::slot));
+	info.put ("capacity", current.load ()->capacity (), sizeof (table::slot));
 	return info;
 }
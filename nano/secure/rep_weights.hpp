@@ -4,8 +4,10 @@
 #include <nano/lib/numbers_templ.hpp>
 #include <nano/lib/utility.hpp>
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
 #include <unordered_map>
 
 namespace nano
@@ -17,10 +19,16 @@ namespace store
 	class write_transaction;
 }
 
+/**
+ * Cached voting weight of representatives
+ * Reads don't take any locks, weights are kept in an open addressing table that writers update in place.
+ * The table is only replaced when it runs out of free slots, a replaced table is freed once no reader can still be using it.
+ */
 class rep_weights
 {
 public:
 	explicit rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a = 0);
+	~rep_weights ();
 	void representation_add (store::write_transaction const & txn_a, nano::account const & source_rep_a, nano::uint128_t const & amount_a);
 	void representation_add_dual (store::write_transaction const & txn_a, nano::account const & source_rep_1, nano::uint128_t const & amount_1, nano::account const & source_rep_2, nano::uint128_t const & amount_2);
 	nano::uint128_t representation_get (nano::account const & account_a) const;
@@ -32,13 +40,33 @@ public:
 	size_t size () const;
 	nano::container_info container_info () const;
 
+	static size_t constexpr initial_capacity = 1024;
+
 private:
-	mutable std::shared_mutex mutex;
-	std::unordered_map<nano::account, nano::uint128_t> rep_amounts;
+	class table;
+	class read_guard;
+
+	// Serializes writers, readers only load the current table
+	mutable std::mutex mutex;
+	std::unique_ptr<table> table_impl;
+	std::atomic<table *> current;
+	std::atomic<size_t> count{ 0 };
+
+	// Readers register in the counter of the current epoch while they use a table, counters are sharded to avoid contention between reader threads
+	struct alignas (64) reader_shard
+	{
+		std::array<std::atomic<uint64_t>, 2> active{};
+	};
+	static size_t constexpr reader_shards = 16;
+	mutable std::atomic<uint64_t> read_epoch{ 0 };
+	mutable std::array<reader_shard, reader_shards> readers;
+	// Waits until readers that might have loaded a replaced table are done with it
+	void synchronize () const;
 	nano::store::rep_weight & rep_weight_store;
 	nano::uint128_t min_weight;
 	void put_cache (nano::account const & account_a, nano::uint128_union const & representation_a);
 	void put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a);
 	nano::uint128_t get (nano::account const & account_a) const;
+	table & grow ();
 };
 }
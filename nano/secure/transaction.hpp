@@ -29,7 +29,8 @@ public:
 	virtual operator const nano::store::transaction & () const = 0;
 
 	// Certain transactions may need to be refreshed if they are held for a long time
-	virtual bool refresh_if_needed (std::chrono::milliseconds max_age = std::chrono::milliseconds{ 500 }) = 0;
+	// Without `max_age` read transactions use the store's maximum staleness and write transactions 500ms
+	virtual bool refresh_if_needed (std::optional<std::chrono::milliseconds> max_age = std::nullopt) = 0;
 };
 
 class write_transaction final : public transaction
@@ -72,10 +73,10 @@ public:
 		renew ();
 	}
 
-	bool refresh_if_needed (std::chrono::milliseconds max_age = std::chrono::milliseconds{ 500 }) override
+	bool refresh_if_needed (std::optional<std::chrono::milliseconds> max_age = std::nullopt) override
 	{
 		auto now = std::chrono::steady_clock::now ();
-		if (now - start > max_age)
+		if (now - start > max_age.value_or (std::chrono::milliseconds{ 500 }))
 		{
 			refresh ();
 			return true;
@@ -122,7 +123,7 @@ public:
 		txn.refresh ();
 	}
 
-	bool refresh_if_needed (std::chrono::milliseconds max_age = std::chrono::milliseconds{ 500 }) override
+	bool refresh_if_needed (std::optional<std::chrono::milliseconds> max_age = std::nullopt) override
 	{
 		return txn.refresh_if_needed (max_age);
 	}
@@ -0,0 +1,65 @@
+#include <nano/crypto_lib/random_pool.hpp>
+#include <nano/lib/network_filter.hpp>
+#include <nano/lib/numbers.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/*
+ * Measures how duplicate filtering throughput scales with the number of threads concurrently applying digests
+ * Mirrors message deserialization on io threads, where every publish and confirm_ack payload passes through the filter
+ */
+TEST (network_filter, profile_concurrency)
+{
+	size_t constexpr filter_size = 1024 * 1024; // Default duplicate_filter_size
+	size_t constexpr operations_per_thread = 2 * 1000 * 1000;
+
+	auto const max_threads = std::max (2u, std::thread::hardware_concurrency ());
+	for (unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+	{
+		nano::network_filter filter{ filter_size };
+
+		// Pre-generate digests, half of them repeated, so that hashing and random number generation aren't measured
+		std::vector<std::vector<nano::uint128_t>> digests (num_threads);
+		for (auto & thread_digests : digests)
+		{
+			thread_digests.reserve (operations_per_thread);
+			for (size_t i = 0; i < operations_per_thread / 2; ++i)
+			{
+				nano::uint128_union digest;
+				nano::random_pool::generate_block (digest.bytes.data (), digest.bytes.size ());
+				thread_digests.push_back (digest.number ());
+				thread_digests.push_back (digest.number ());
+			}
+		}
+
+		auto const start = std::chrono::steady_clock::now ();
+		std::vector<std::thread> threads;
+		for (auto & thread_digests : digests)
+		{
+			threads.emplace_back ([&filter, &thread_digests] () {
+				for (auto const & digest : thread_digests)
+				{
+					filter.apply (digest);
+				}
+			});
+		}
+		for (auto & thread : threads)
+		{
+			thread.join ();
+		}
+		auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start);
+
+		auto const total = num_threads * operations_per_thread;
+		std::cout << "threads: " << num_threads
+				  << ", operations: " << total
+				  << ", time: " << elapsed.count () / 1000 << " ms"
+				  << ", throughput: " << (total * 1000000 / std::max<int64_t> (elapsed.count (), 1)) << " ops/s"
+				  << std::endl;
+	}
+}
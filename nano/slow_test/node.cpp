@@ -11,6 +11,7 @@
 #include <nano/node/scheduler/component.hpp>
 #include <nano/node/scheduler/manual.hpp>
 #include <nano/node/scheduler/priority.hpp>
+#include <nano/node/signature_checker.hpp>
 #include <nano/node/telemetry.hpp>
 #include <nano/node/transport/inproc.hpp>
 #include <nano/node/unchecked_map.hpp>
@@ -1144,7 +1145,8 @@ TEST (confirmation_height, many_accounts_send_receive_self_no_elections)
 
 	nano::node_config node_config;
 	nano::unchecked_map unchecked{ 0, stats, false };
-	nano::block_processor block_processor{ node_config, ledger, unchecked, stats, logger };
+	nano::signature_checker signature_checker{ 0, 0, stats };
+	nano::block_processor block_processor{ node_config, ledger, unchecked, signature_checker, stats, logger };
 	nano::confirming_set_config confirming_set_config{};
 	nano::confirming_set confirming_set{ confirming_set_config, ledger, block_processor, stats, logger };
 
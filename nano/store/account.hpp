@@ -28,6 +28,8 @@ public:
 	virtual void put (write_transaction const & tx, nano::account const &, nano::account_info const &) = 0;
 	virtual bool get (transaction const & tx, nano::account const &, nano::account_info &) = 0;
 	std::optional<nano::account_info> get (transaction const & tx, nano::account const &);
+	/** Batched lookup, results are in the same order as the accounts */
+	virtual std::vector<std::optional<nano::account_info>> get_multiple (transaction const & tx, std::vector<nano::account> const &) = 0;
 	virtual void del (write_transaction const & tx, nano::account const &) = 0;
 	virtual bool exists (transaction const & tx, nano::account const &) = 0;
 	virtual size_t count (transaction const & tx) = 0;
@@ -30,6 +30,10 @@ public:
 	virtual std::optional<nano::block_hash> successor (transaction const & tx, nano::block_hash const &) const = 0;
 	virtual void successor_clear (write_transaction const & tx, nano::block_hash const &) = 0;
 	virtual std::shared_ptr<nano::block> get (transaction const & tx, nano::block_hash const &) const = 0;
+	/** Batched lookup, results are in the same order as the hashes, null for blocks that don't exist */
+	virtual std::vector<std::shared_ptr<nano::block>> get_multiple (transaction const & tx, std::vector<nano::block_hash> const &) const = 0;
+	// Reads only the sideband of a block, cheaper than `get` when the block contents are not needed
+	virtual std::optional<nano::block_sideband> sideband (transaction const & tx, nano::block_hash const &) const = 0;
 	virtual void del (write_transaction const & tx, nano::block_hash const &) = 0;
 	virtual bool exists (transaction const & tx, nano::block_hash const &) = 0;
 	virtual uint64_t count (transaction const & tx) = 0;
@@ -0,0 +1,4 @@
+#include <nano/store/delegator.hpp>
+#include <nano/store/typed_iterator_templ.hpp>
+
+template class nano::store::typed_iterator<nano::uint512_union, std::nullptr_t>;
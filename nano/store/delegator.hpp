@@ -0,0 +1,33 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/typed_iterator.hpp>
+
+#include <cstdint>
+
+namespace nano::store
+{
+/**
+ * Index of accounts by their representative, kept in sync with the representative field of the accounts table
+ * Keys are the representative followed by the delegating account, so all delegators of a representative are adjacent
+ */
+class delegator
+{
+public:
+	// Key is <representative, account> stored in uint256s[0] and uint256s[1] respectively
+	using iterator = typed_iterator<nano::uint512_union, std::nullptr_t>;
+
+public:
+	virtual ~delegator (){};
+	virtual void put (store::write_transaction const &, nano::account const & representative, nano::account const & account) = 0;
+	virtual void del (store::write_transaction const &, nano::account const & representative, nano::account const & account) = 0;
+	virtual bool exists (store::transaction const &, nano::account const & representative, nano::account const & account) const = 0;
+	virtual uint64_t count (store::transaction const &) const = 0;
+	virtual void clear (store::write_transaction const &) = 0;
+	/** Iterates delegators of \p representative starting from \p account, iteration continues past the representative's entries */
+	virtual iterator begin (store::transaction const &, nano::account const & representative, nano::account const & account = 0) const = 0;
+	virtual iterator begin (store::transaction const &) const = 0;
+	virtual iterator end (store::transaction const &) const = 0;
+};
+}
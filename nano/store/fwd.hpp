@@ -10,6 +10,7 @@ class account;
 class block;
 class component;
 class confirmation_height;
+class delegator;
 class final_vote;
 class online_weight;
 class peer;
@@ -85,10 +85,10 @@ void nano::store::lmdb::block::successor_clear (store::write_transaction const &
 	raw_put (transaction, data, hash);
 }
 
-std::shared_ptr<nano::block> nano::store::lmdb::block::get (store::transaction const & transaction, nano::block_hash const & hash) const
+namespace
+{
+std::shared_ptr<nano::block> deserialize_block_with_sideband (nano::store::lmdb::db_val const & value)
 {
-	nano::store::lmdb::db_val value;
-	block_raw_get (transaction, hash, value);
 	std::shared_ptr<nano::block> result;
 	if (value.size () != 0)
 	{
@@ -105,6 +105,48 @@ std::shared_ptr<nano::block> nano::store::lmdb::block::get (store::transaction c
 	}
 	return result;
 }
+}
+
+std::shared_ptr<nano::block> nano::store::lmdb::block::get (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	nano::store::lmdb::db_val value;
+	block_raw_get (transaction, hash, value);
+	return deserialize_block_with_sideband (value);
+}
+
+std::vector<std::shared_ptr<nano::block>> nano::store::lmdb::block::get_multiple (store::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const
+{
+	std::vector<nano::store::lmdb::db_val> keys (hashes.begin (), hashes.end ());
+	std::vector<nano::store::lmdb::db_val> values;
+	auto statuses = store.get_multiple (transaction, tables::blocks, keys, values);
+	std::vector<std::shared_ptr<nano::block>> result (hashes.size ());
+	for (size_t i = 0; i < hashes.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			result[i] = deserialize_block_with_sideband (values[i]);
+		}
+	}
+	return result;
+}
+
+std::optional<nano::block_sideband> nano::store::lmdb::block::sideband (store::transaction const & transaction, nano::block_hash const & hash) const
+{
+	nano::store::lmdb::db_val value;
+	block_raw_get (transaction, hash, value);
+	if (value.size () == 0)
+	{
+		return std::nullopt;
+	}
+	auto type = block_type_from_raw (value.data ());
+	auto offset = value.size () - nano::block_sideband::size (type);
+	nano::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()) + offset, value.size () - offset);
+	nano::block_sideband result;
+	auto error (result.deserialize (stream, type));
+	release_assert (!error);
+	return result;
+}
 
 void nano::store::lmdb::block::del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a)
 {
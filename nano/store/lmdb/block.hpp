@@ -27,6 +27,8 @@ public:
 	std::optional<nano::block_hash> successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
 	void successor_clear (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	std::shared_ptr<nano::block> get (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	std::vector<std::shared_ptr<nano::block>> get_multiple (store::transaction const & transaction_a, std::vector<nano::block_hash> const & hashes_a) const override;
+	std::optional<nano::block_sideband> sideband (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
 	void del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	bool exists (store::transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	uint64_t count (store::transaction const & transaction_a) override;
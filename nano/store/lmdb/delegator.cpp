@@ -0,0 +1,52 @@
+#include <nano/store/lmdb/delegator.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+
+nano::store::lmdb::delegator::delegator (nano::store::lmdb::component & store_a) :
+	store{ store_a }
+{
+}
+
+void nano::store::lmdb::delegator::put (store::write_transaction const & transaction, nano::account const & representative, nano::account const & account)
+{
+	auto status = store.put (transaction, tables::delegators, nano::uint512_union{ representative, account }, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::lmdb::delegator::del (store::write_transaction const & transaction, nano::account const & representative, nano::account const & account)
+{
+	auto status = store.del (transaction, tables::delegators, nano::uint512_union{ representative, account });
+	store.release_assert_success (status);
+}
+
+bool nano::store::lmdb::delegator::exists (store::transaction const & transaction, nano::account const & representative, nano::account const & account) const
+{
+	return store.exists (transaction, tables::delegators, nano::uint512_union{ representative, account });
+}
+
+uint64_t nano::store::lmdb::delegator::count (store::transaction const & transaction) const
+{
+	return store.count (transaction, tables::delegators);
+}
+
+void nano::store::lmdb::delegator::clear (store::write_transaction const & transaction)
+{
+	auto status = store.drop (transaction, tables::delegators);
+	store.release_assert_success (status);
+}
+
+auto nano::store::lmdb::delegator::begin (store::transaction const & transaction, nano::account const & representative, nano::account const & account) const -> iterator
+{
+	nano::uint512_union key{ representative, account };
+	lmdb::db_val val{ key };
+	return iterator{ store::iterator{ lmdb::iterator::lower_bound (store.env.tx (transaction), delegators_handle, val) } };
+}
+
+auto nano::store::lmdb::delegator::begin (store::transaction const & transaction) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::begin (store.env.tx (transaction), delegators_handle) } };
+}
+
+auto nano::store::lmdb::delegator::end (store::transaction const & transaction) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::end (store.env.tx (transaction), delegators_handle) } };
+}
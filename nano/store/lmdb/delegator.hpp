@@ -0,0 +1,34 @@
+#pragma once
+
+#include <nano/store/delegator.hpp>
+
+#include <lmdb/libraries/liblmdb/lmdb.h>
+
+namespace nano::store::lmdb
+{
+class component;
+
+class delegator : public nano::store::delegator
+{
+private:
+	nano::store::lmdb::component & store;
+
+public:
+	explicit delegator (nano::store::lmdb::component & store_a);
+
+	void put (store::write_transaction const &, nano::account const & representative, nano::account const & account) override;
+	void del (store::write_transaction const &, nano::account const & representative, nano::account const & account) override;
+	bool exists (store::transaction const &, nano::account const & representative, nano::account const & account) const override;
+	uint64_t count (store::transaction const &) const override;
+	void clear (store::write_transaction const &) override;
+	iterator begin (store::transaction const &, nano::account const & representative, nano::account const & account) const override;
+	iterator begin (store::transaction const &) const override;
+	iterator end (store::transaction const &) const override;
+
+	/**
+	 * Accounts by representative
+	 * nano::uint512_union <representative, account> -> none
+	 */
+	MDB_dbi delegators_handle{ 0 };
+};
+}
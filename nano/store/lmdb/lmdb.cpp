@@ -1,3 +1,4 @@
+#include <nano/lib/config.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/stream.hpp>
 #include <nano/lib/utility.hpp>
@@ -13,6 +14,8 @@
 #include <boost/format.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <cstring>
+#include <numeric>
 #include <queue>
 
 template class nano::store::typed_iterator<nano::account, nano::account_info_v22>;
@@ -29,7 +32,8 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 		confirmation_height_store,
 		final_vote_store,
 		version_store,
-		rep_weight_store
+		rep_weight_store,
+		delegator_store
 	},
 	// clang-format on
 	block_store{ *this },
@@ -42,6 +46,7 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	delegator_store{ *this },
 	logger{ logger_a },
 	env (error, path_a, nano::store::lmdb::env::options::make ().set_config (lmdb_config_a).set_use_no_mem_init (true)),
 	mdb_txn_tracker (logger_a, txn_tracking_config_a, block_processor_batch_max_time_a),
@@ -109,6 +114,9 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 			auto transaction (tx_begin_read ());
 			open_databases (error, transaction, 0);
 		}
+
+		// All databases are open, read transactions can be reused from now on
+		env.enable_read_pool ();
 	}
 }
 
@@ -161,6 +169,7 @@ void nano::store::lmdb::component::serialize_memory_stats (boost::property_tree:
 	json.put ("leaf_pages", stats.ms_leaf_pages);
 	json.put ("overflow_pages", stats.ms_overflow_pages);
 	json.put ("page_size", stats.ms_psize);
+	env.serialize_read_pool_stats (json);
 }
 
 nano::store::write_transaction nano::store::lmdb::component::tx_begin_write ()
@@ -207,6 +216,7 @@ void nano::store::lmdb::component::open_databases (bool & error_a, store::transa
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "final_votes", flags, &final_vote_store.final_votes_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "blocks", MDB_CREATE, &block_store.blocks_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "rep_weights", flags, &rep_weight_store.rep_weights_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "delegators", flags, &delegator_store.delegators_handle) != 0;
 }
 
 bool nano::store::lmdb::component::do_upgrades (store::write_transaction & transaction, nano::ledger_constants & constants, bool & needs_vacuuming)
@@ -230,6 +240,9 @@ bool nano::store::lmdb::component::do_upgrades (store::write_transaction & trans
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
 			break;
 		default:
 			logger.critical (nano::log::type::lmdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -321,6 +334,39 @@ void nano::store::lmdb::component::upgrade_v23_to_v24 (store::write_transaction
 	logger.info (nano::log::type::lmdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Fill delegators table with the representative of every existing account
+void nano::store::lmdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25...");
+
+	drop (transaction, tables::delegators);
+	transaction.refresh ();
+
+	// Small batches in dev builds so that upgrade tests go through the periodic refresh as well
+	const size_t batch_size = nano::is_dev_run () ? 64 : 250000;
+
+	size_t processed = 0;
+	{
+		auto read_transaction = tx_begin_read ();
+		for (auto it = account.begin (read_transaction), end = account.end (read_transaction); it != end; ++it)
+		{
+			delegator.put (transaction, it->second.representative, it->first);
+
+			processed++;
+			if (processed % batch_size == 0)
+			{
+				logger.info (nano::log::type::lmdb, "Processed {} accounts", processed);
+				transaction.refresh (); // Refresh to prevent excessive memory usage
+			}
+		}
+	}
+
+	logger.info (nano::log::type::lmdb, "Done processing {} accounts", processed);
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25 completed");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void nano::store::lmdb::component::create_backup_file (nano::store::lmdb::env & env_a, std::filesystem::path const & filepath_a, nano::logger & logger)
 {
@@ -361,6 +407,42 @@ int nano::store::lmdb::component::get (store::transaction const & transaction_a,
 	return mdb_get (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a);
 }
 
+std::vector<int> nano::store::lmdb::component::get_multiple (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::lmdb::db_val> const & keys_a, std::vector<nano::store::lmdb::db_val> & values_a) const
+{
+	std::vector<int> result (keys_a.size (), MDB_NOTFOUND);
+	values_a.assign (keys_a.size (), nano::store::lmdb::db_val{});
+	if (keys_a.empty ())
+	{
+		return result;
+	}
+
+	// Visiting keys in database order keeps consecutive lookups on neighbouring pages
+	std::vector<size_t> order (keys_a.size ());
+	std::iota (order.begin (), order.end (), 0);
+	std::sort (order.begin (), order.end (), [&keys_a] (size_t lhs, size_t rhs) {
+		auto const & left = keys_a[lhs];
+		auto const & right = keys_a[rhs];
+		auto const compare = std::memcmp (left.data (), right.data (), std::min (left.size (), right.size ()));
+		return compare < 0 || (compare == 0 && left.size () < right.size ());
+	});
+
+	MDB_cursor * cursor;
+	auto status (mdb_cursor_open (env.tx (transaction_a), table_to_dbi (table_a), &cursor));
+	release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+	for (auto index : order)
+	{
+		MDB_val key{ keys_a[index].size (), keys_a[index].data () };
+		MDB_val value{};
+		result[index] = mdb_cursor_get (cursor, &key, &value, MDB_SET_KEY);
+		if (result[index] == MDB_SUCCESS)
+		{
+			values_a[index] = nano::store::lmdb::db_val{ value };
+		}
+	}
+	mdb_cursor_close (cursor);
+	return result;
+}
+
 int nano::store::lmdb::component::put (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val const & value_a) const
 {
 	return (mdb_put (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a, 0));
@@ -418,6 +500,8 @@ MDB_dbi nano::store::lmdb::component::table_to_dbi (tables table_a) const
 			return final_vote_store.final_votes_handle;
 		case tables::rep_weights:
 			return rep_weight_store.rep_weights_handle;
+		case tables::delegators:
+			return delegator_store.delegators_handle;
 		default:
 			release_assert (false);
 			return peer_store.peers_handle;
@@ -10,6 +10,7 @@
 #include <nano/store/lmdb/block.hpp>
 #include <nano/store/lmdb/confirmation_height.hpp>
 #include <nano/store/lmdb/db_val.hpp>
+#include <nano/store/lmdb/delegator.hpp>
 #include <nano/store/lmdb/final_vote.hpp>
 #include <nano/store/lmdb/iterator.hpp>
 #include <nano/store/lmdb/lmdb_env.hpp>
@@ -50,6 +51,7 @@ private:
 	nano::store::lmdb::pruned pruned_store;
 	nano::store::lmdb::version version_store;
 	nano::store::lmdb::rep_weight rep_weight_store;
+	nano::store::lmdb::delegator delegator_store;
 
 	friend class nano::store::lmdb::account;
 	friend class nano::store::lmdb::block;
@@ -61,6 +63,7 @@ private:
 	friend class nano::store::lmdb::pruned;
 	friend class nano::store::lmdb::version;
 	friend class nano::store::lmdb::rep_weight;
+	friend class nano::store::lmdb::delegator;
 
 public:
 	component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::txn_tracking_config const & txn_tracking_config_a = nano::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), nano::lmdb_config const & lmdb_config_a = nano::lmdb_config{}, bool backup_before_upgrade = false);
@@ -87,6 +90,8 @@ public:
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a) const;
 
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val & value_a) const;
+	/** Looks up keys in sorted order with a single cursor, results are returned in the order of the keys */
+	std::vector<int> get_multiple (store::transaction const &, tables, std::vector<nano::store::lmdb::db_val> const & keys, std::vector<nano::store::lmdb::db_val> & values) const;
 	int put (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val const & value_a) const;
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a) const;
 
@@ -103,6 +108,7 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
 
 	void open_databases (bool &, store::transaction const &, unsigned);
 
@@ -144,6 +150,7 @@ private:
 
 	friend class mdb_block_store_supported_version_upgrades_Test;
 	friend class mdb_block_store_upgrade_v21_v22_Test;
+	friend class mdb_block_store_upgrade_v24_v25_Test;
 	friend class block_store_DISABLED_change_dupsort_Test;
 };
 } // namespace nano::store::lmdb
@@ -2,6 +2,7 @@
 #include <nano/lib/utility.hpp>
 #include <nano/store/lmdb/lmdb_env.hpp>
 
+#include <boost/property_tree/ptree.hpp>
 #include <boost/system/error_code.hpp>
 
 nano::store::lmdb::env::env (bool & error_a, std::filesystem::path const & path_a, nano::store::lmdb::env::options options_a)
@@ -13,6 +14,13 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 {
 	debug_assert (path_a.extension () == ".ldb", "invalid filename extension for lmdb database file");
 
+	// The environment might be reopened, pooled transactions belong to the previous one
+	read_pool_clear ();
+	read_pool_enabled = false;
+	read_pool_max = options_a.config.read_transaction_pool;
+	read_pool_max_idle = options_a.config.read_transaction_max_idle;
+	read_txn_max_staleness = options_a.config.read_transaction_max_staleness;
+
 	boost::system::error_code error_mkdir, error_chmod;
 	if (path_a.has_parent_path ())
 	{
@@ -79,6 +87,7 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 
 nano::store::lmdb::env::~env ()
 {
+	read_pool_clear ();
 	if (environment != nullptr)
 	{
 		// Make sure the commits are flushed. This is a no-op unless MDB_NOSYNC is used.
@@ -106,3 +115,115 @@ MDB_txn * nano::store::lmdb::env::tx (store::transaction const & transaction_a)
 	debug_assert (transaction_a.store_id () == store_id);
 	return static_cast<MDB_txn *> (transaction_a.get_handle ());
 }
+
+void nano::store::lmdb::env::enable_read_pool ()
+{
+	read_pool_enabled = read_pool_max > 0;
+}
+
+MDB_txn * nano::store::lmdb::env::read_txn_acquire () const
+{
+	auto const start = std::chrono::steady_clock::now ();
+
+	MDB_txn * handle = nullptr;
+	if (read_pool_enabled)
+	{
+		nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+		if (!read_pool.empty ())
+		{
+			handle = read_pool.front ().handle;
+			read_pool.pop_front ();
+		}
+	}
+
+	if (handle != nullptr)
+	{
+		auto status (mdb_txn_renew (handle));
+		release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+		++read_txn_renewals;
+	}
+	else
+	{
+		auto status (mdb_txn_begin (environment.get (), nullptr, MDB_RDONLY, &handle));
+		release_assert (status == MDB_SUCCESS, mdb_strerror (status));
+		++read_txn_begins;
+	}
+
+	read_txn_begin_time += std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now () - start).count ();
+	return handle;
+}
+
+void nano::store::lmdb::env::read_txn_release (MDB_txn * handle, std::chrono::steady_clock::time_point snapshot_time) const
+{
+	read_txn_check_staleness (snapshot_time);
+	if (read_pool_enabled)
+	{
+		// Releases the snapshot but keeps the reader slot
+		mdb_txn_reset (handle);
+
+		auto const now = std::chrono::steady_clock::now ();
+
+		std::vector<MDB_txn *> expired;
+		{
+			nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+			read_pool.push_front ({ handle, now });
+			// Idle transactions are at the back, drop them along with any over the pool limit
+			while (!read_pool.empty () && (read_pool.size () > read_pool_max || read_pool.back ().released + read_pool_max_idle < now))
+			{
+				expired.push_back (read_pool.back ().handle);
+				read_pool.pop_back ();
+			}
+		}
+		for (auto expired_handle : expired)
+		{
+			mdb_txn_abort (expired_handle);
+		}
+		read_txn_expired += expired.size ();
+	}
+	else
+	{
+		// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
+		auto status (mdb_txn_commit (handle));
+		release_assert (status == MDB_SUCCESS);
+	}
+}
+
+void nano::store::lmdb::env::read_txn_check_staleness (std::chrono::steady_clock::time_point snapshot_time) const
+{
+	if (std::chrono::steady_clock::now () - snapshot_time > read_txn_max_staleness)
+	{
+		++read_txn_stale;
+	}
+}
+
+void nano::store::lmdb::env::read_pool_clear ()
+{
+	nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+	for (auto const & entry : read_pool)
+	{
+		mdb_txn_abort (entry.handle);
+	}
+	read_pool.clear ();
+}
+
+void nano::store::lmdb::env::serialize_read_pool_stats (boost::property_tree::ptree & json) const
+{
+	size_t pooled = 0;
+	{
+		nano::lock_guard<nano::mutex> guard{ read_pool_mutex };
+		pooled = read_pool.size ();
+	}
+	MDB_envinfo info;
+	auto status (mdb_env_info (environment.get (), &info));
+	release_assert (status == MDB_SUCCESS);
+
+	uint64_t const begins = read_txn_begins + read_txn_renewals;
+	json.put ("read_txn_begins", read_txn_begins.load ());
+	json.put ("read_txn_renewals", read_txn_renewals.load ());
+	json.put ("read_txn_expired", read_txn_expired.load ());
+	json.put ("read_txn_stale", read_txn_stale.load ());
+	json.put ("read_txn_begin_avg_ns", begins > 0 ? read_txn_begin_time / begins : 0);
+	json.put ("read_txn_pooled", pooled);
+	json.put ("reader_slots_used", info.me_numreaders); // High water mark of reader slots in use
+	json.put ("reader_slots_max", info.me_maxreaders);
+}
@@ -2,9 +2,15 @@
 
 #include <nano/lib/id_dispenser.hpp>
 #include <nano/lib/lmdbconfig.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/lmdb/transaction_impl.hpp>
 
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <atomic>
+#include <deque>
+
 namespace nano::store::lmdb
 {
 /**
@@ -62,7 +68,44 @@ public:
 	store::read_transaction tx_begin_read (txn_callbacks callbacks = txn_callbacks{}) const;
 	store::write_transaction tx_begin_write (txn_callbacks callbacks = txn_callbacks{}) const;
 	MDB_txn * tx (store::transaction const & transaction_a) const;
+
+	/**
+	 * Read transactions are reset instead of aborted when finished and renewed by the next reader, avoiding the cost of acquiring a reader slot
+	 * Must only be enabled after all databases are opened, since database handles opened by a reset transaction are discarded
+	 */
+	void enable_read_pool ();
+	MDB_txn * read_txn_acquire () const;
+	/** `snapshot_time` is when the handle was last begun or renewed, to count readers that kept it past the maximum staleness */
+	void read_txn_release (MDB_txn *, std::chrono::steady_clock::time_point snapshot_time) const;
+	void read_txn_check_staleness (std::chrono::steady_clock::time_point snapshot_time) const;
+	void serialize_read_pool_stats (boost::property_tree::ptree &) const;
+
+	/** Long running readers renew their snapshot through `refresh_if_needed ()` once it is older than this */
+	std::chrono::milliseconds read_txn_max_staleness{ 500 };
+
 	std::unique_ptr<MDB_env, decltype (&mdb_env_close)> environment{ nullptr, mdb_env_close };
 	nano::id_t const store_id{ nano::next_id () };
+
+private:
+	void read_pool_clear ();
+
+	struct pooled_txn
+	{
+		MDB_txn * handle;
+		std::chrono::steady_clock::time_point released;
+	};
+
+	size_t read_pool_max{ 0 };
+	std::chrono::milliseconds read_pool_max_idle{ 0 };
+	std::atomic<bool> read_pool_enabled{ false };
+	mutable nano::mutex read_pool_mutex;
+	// Most recently released at the front
+	mutable std::deque<pooled_txn> read_pool;
+
+	mutable std::atomic<uint64_t> read_txn_begins{ 0 };
+	mutable std::atomic<uint64_t> read_txn_renewals{ 0 };
+	mutable std::atomic<uint64_t> read_txn_begin_time{ 0 }; // Nanoseconds spent beginning or renewing read transactions
+	mutable std::atomic<uint64_t> read_txn_expired{ 0 };
+	mutable std::atomic<uint64_t> read_txn_stale{ 0 }; // Snapshots held for longer than the maximum staleness
 };
 } // namespace nano::store::lmdb
@@ -37,24 +37,24 @@ private:
 
 nano::store::lmdb::read_transaction_impl::read_transaction_impl (nano::store::lmdb::env const & environment_a, nano::store::lmdb::txn_callbacks txn_callbacks_a) :
 	store::read_transaction_impl (environment_a.store_id),
-	txn_callbacks (txn_callbacks_a)
+	handle (environment_a.read_txn_acquire ()),
+	env (environment_a),
+	txn_callbacks (txn_callbacks_a),
+	snapshot_time (std::chrono::steady_clock::now ())
 {
-	auto status (mdb_txn_begin (environment_a, nullptr, MDB_RDONLY, &handle));
-	release_assert (status == 0);
 	txn_callbacks.txn_start (this);
 }
 
 nano::store::lmdb::read_transaction_impl::~read_transaction_impl ()
 {
-	// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
-	auto status (mdb_txn_commit (handle));
-	release_assert (status == MDB_SUCCESS);
+	env.read_txn_release (handle, snapshot_time);
 	txn_callbacks.txn_end (this);
 }
 
 void nano::store::lmdb::read_transaction_impl::reset ()
 {
 	mdb_txn_reset (handle);
+	env.read_txn_check_staleness (snapshot_time);
 	txn_callbacks.txn_end (this);
 }
 
@@ -62,9 +62,15 @@ void nano::store::lmdb::read_transaction_impl::renew ()
 {
 	auto status (mdb_txn_renew (handle));
 	release_assert (status == 0);
+	snapshot_time = std::chrono::steady_clock::now ();
 	txn_callbacks.txn_start (this);
 }
 
+std::chrono::milliseconds nano::store::lmdb::read_transaction_impl::max_staleness () const
+{
+	return env.read_txn_max_staleness;
+}
+
 void * nano::store::lmdb::read_transaction_impl::get_handle () const
 {
 	return handle;
@@ -33,9 +33,13 @@ public:
 	~read_transaction_impl ();
 	void reset () override;
 	void renew () override;
+	std::chrono::milliseconds max_staleness () const override;
 	void * get_handle () const override;
 	MDB_txn * handle;
+	nano::store::lmdb::env const & env;
 	lmdb::txn_callbacks txn_callbacks;
+	/** When the current snapshot was taken, used to count readers that held it past the maximum staleness */
+	std::chrono::steady_clock::time_point snapshot_time;
 };
 
 class write_transaction_impl final : public store::write_transaction_impl
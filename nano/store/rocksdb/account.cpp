@@ -26,6 +26,27 @@ bool nano::store::rocksdb::account::get (store::transaction const & transaction,
 	return result;
 }
 
+std::vector<std::optional<nano::account_info>> nano::store::rocksdb::account::get_multiple (store::transaction const & transaction_a, std::vector<nano::account> const & accounts_a)
+{
+	std::vector<nano::store::rocksdb::db_val> keys (accounts_a.begin (), accounts_a.end ());
+	std::vector<nano::store::rocksdb::db_val> values;
+	auto statuses = store.get_multiple (transaction_a, tables::accounts, keys, values);
+	std::vector<std::optional<nano::account_info>> result (accounts_a.size ());
+	for (size_t i = 0; i < accounts_a.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			nano::bufferstream stream (reinterpret_cast<uint8_t const *> (values[i].data ()), values[i].size ());
+			nano::account_info info;
+			auto error = info.deserialize (stream);
+			release_assert (!error);
+			result[i] = info;
+		}
+	}
+	return result;
+}
+
 void nano::store::rocksdb::account::del (store::write_transaction const & transaction_a, nano::account const & account_a)
 {
 	auto status = store.del (transaction_a, tables::accounts, account_a);
@@ -17,6 +17,7 @@ public:
 	explicit account (nano::store::rocksdb::component & store_a);
 	void put (store::write_transaction const & transaction, nano::account const & account, nano::account_info const & info) override;
 	bool get (store::transaction const & transaction_a, nano::account const & account_a, nano::account_info & info_a) override;
+	std::vector<std::optional<nano::account_info>> get_multiple (store::transaction const & transaction_a, std::vector<nano::account> const & accounts_a) override;
 	void del (store::write_transaction const & transaction_a, nano::account const & account_a) override;
 	bool exists (store::transaction const & transaction_a, nano::account const & account_a) override;
 	size_t count (store::transaction const & transaction_a) override;
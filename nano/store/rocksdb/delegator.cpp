@@ -0,0 +1,53 @@
+#include <nano/store/rocksdb/delegator.hpp>
+#include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/rocksdb/utility.hpp>
+
+nano::store::rocksdb::delegator::delegator (nano::store::rocksdb::component & store_a) :
+	store{ store_a }
+{
+}
+
+void nano::store::rocksdb::delegator::put (store::write_transaction const & transaction, nano::account const & representative, nano::account const & account)
+{
+	auto status = store.put (transaction, tables::delegators, nano::uint512_union{ representative, account }, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::rocksdb::delegator::del (store::write_transaction const & transaction, nano::account const & representative, nano::account const & account)
+{
+	auto status = store.del (transaction, tables::delegators, nano::uint512_union{ representative, account });
+	store.release_assert_success (status);
+}
+
+bool nano::store::rocksdb::delegator::exists (store::transaction const & transaction, nano::account const & representative, nano::account const & account) const
+{
+	return store.exists (transaction, tables::delegators, nano::uint512_union{ representative, account });
+}
+
+uint64_t nano::store::rocksdb::delegator::count (store::transaction const & transaction) const
+{
+	return store.count (transaction, tables::delegators);
+}
+
+void nano::store::rocksdb::delegator::clear (store::write_transaction const & transaction)
+{
+	auto status = store.drop (transaction, tables::delegators);
+	store.release_assert_success (status);
+}
+
+auto nano::store::rocksdb::delegator::begin (store::transaction const & transaction, nano::account const & representative, nano::account const & account) const -> iterator
+{
+	nano::uint512_union key{ representative, account };
+	rocksdb::db_val val{ key };
+	return iterator{ store::iterator{ rocksdb::iterator::lower_bound (store.db.get (), rocksdb::tx (transaction), store.table_to_column_family (tables::delegators), val) } };
+}
+
+auto nano::store::rocksdb::delegator::begin (store::transaction const & transaction) const -> iterator
+{
+	return iterator{ store::iterator{ rocksdb::iterator::begin (store.db.get (), rocksdb::tx (transaction), store.table_to_column_family (tables::delegators)) } };
+}
+
+auto nano::store::rocksdb::delegator::end (store::transaction const & transaction) const -> iterator
+{
+	return iterator{ store::iterator{ rocksdb::iterator::end (store.db.get (), rocksdb::tx (transaction), store.table_to_column_family (tables::delegators)) } };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <nano/store/delegator.hpp>
+
+namespace nano::store::rocksdb
+{
+class component;
+}
+namespace nano::store::rocksdb
+{
+class delegator : public nano::store::delegator
+{
+private:
+	nano::store::rocksdb::component & store;
+
+public:
+	explicit delegator (nano::store::rocksdb::component & store_a);
+
+	void put (store::write_transaction const &, nano::account const & representative, nano::account const & account) override;
+	void del (store::write_transaction const &, nano::account const & representative, nano::account const & account) override;
+	bool exists (store::transaction const &, nano::account const & representative, nano::account const & account) const override;
+	uint64_t count (store::transaction const &) const override;
+	void clear (store::write_transaction const &) override;
+	iterator begin (store::transaction const &, nano::account const & representative, nano::account const & account) const override;
+	iterator begin (store::transaction const &) const override;
+	iterator end (store::transaction const &) const override;
+};
+}
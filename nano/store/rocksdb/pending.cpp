@@ -34,6 +34,26 @@ std::optional<nano::pending_info> nano::store::rocksdb::pending::get (store::tra
 	return result;
 }
 
+std::vector<std::optional<nano::pending_info>> nano::store::rocksdb::pending::get_multiple (store::transaction const & transaction_a, std::vector<nano::pending_key> const & keys_a)
+{
+	std::vector<nano::store::rocksdb::db_val> keys (keys_a.begin (), keys_a.end ());
+	std::vector<nano::store::rocksdb::db_val> values;
+	auto statuses = store.get_multiple (transaction_a, tables::pending, keys, values);
+	std::vector<std::optional<nano::pending_info>> result (keys_a.size ());
+	for (size_t i = 0; i < keys_a.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			nano::bufferstream stream (reinterpret_cast<uint8_t const *> (values[i].data ()), values[i].size ());
+			result[i] = nano::pending_info{};
+			auto error = result[i].value ().deserialize (stream);
+			release_assert (!error);
+		}
+	}
+	return result;
+}
+
 bool nano::store::rocksdb::pending::exists (store::transaction const & transaction_a, nano::pending_key const & key_a)
 {
 	auto iterator (begin (transaction_a, key_a));
@@ -14,6 +14,7 @@ public:
 	void put (store::write_transaction const & transaction_a, nano::pending_key const & key_a, nano::pending_info const & pending_info_a) override;
 	void del (store::write_transaction const & transaction_a, nano::pending_key const & key_a) override;
 	std::optional<nano::pending_info> get (store::transaction const & transaction_a, nano::pending_key const & key_a) override;
+	std::vector<std::optional<nano::pending_info>> get_multiple (store::transaction const & transaction_a, std::vector<nano::pending_key> const & keys_a) override;
 	bool exists (store::transaction const & transaction_a, nano::pending_key const & key_a) override;
 	bool any (store::transaction const & transaction_a, nano::account const & account_a) override;
 	iterator begin (store::transaction const & transaction_a, nano::pending_key const & key_a) const override;
@@ -1,5 +1,6 @@
 #include <nano/lib/block_type.hpp>
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/config.hpp>
 #include <nano/lib/files.hpp>
 #include <nano/lib/rocksdbconfig.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
@@ -50,7 +51,8 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 		confirmation_height_store,
 		final_vote_store,
 		version_store,
-		rep_weight_store
+		rep_weight_store,
+		delegator_store
 	},
 	// clang-format on
 	block_store{ *this },
@@ -63,10 +65,12 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	delegator_store{ *this },
 	logger{ logger_a },
 	constants{ constants },
 	rocksdb_config{ rocksdb_config_a },
 	max_block_write_batch_num_m{ nano::narrow_cast<unsigned> ((rocksdb_config_a.write_cache * 1024 * 1024) / (2 * (sizeof (nano::block_type) + nano::state_block::size + nano::block_sideband::size (nano::block_type::state)))) },
+	shared_read_cache{ rocksdb_config_a.shared_read_cache > 0 ? ::rocksdb::NewLRUCache (rocksdb_config_a.shared_read_cache * 1024 * 1024) : nullptr },
 	cf_name_table_map{ create_cf_name_table_map () }
 {
 	boost::system::error_code error_mkdir, error_chmod;
@@ -169,7 +173,8 @@ std::unordered_map<char const *, nano::tables> nano::store::rocksdb::component::
 		{ "confirmation_height", tables::confirmation_height },
 		{ "pruned", tables::pruned },
 		{ "final_votes", tables::final_votes },
-		{ "rep_weights", tables::rep_weights } };
+		{ "rep_weights", tables::rep_weights },
+		{ "delegators", tables::delegators } };
 
 	debug_assert (map.size () == all_tables ().size () + 1);
 	return map;
@@ -227,6 +232,9 @@ bool nano::store::rocksdb::component::do_upgrades (store::write_transaction & tr
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
 			break;
 		default:
 			logger.critical (nano::log::type::rocksdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -374,6 +382,64 @@ void nano::store::rocksdb::component::upgrade_v23_to_v24 (store::write_transacti
 	logger.info (nano::log::type::rocksdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Fill delegators table with the representative of every existing account
+void nano::store::rocksdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25...");
+
+	if (column_family_exists ("delegators"))
+	{
+		logger.info (nano::log::type::rocksdb, "Dropping existing delegators table");
+		auto const delegators_handle = get_column_family ("delegators");
+		db->DropColumnFamily (delegators_handle);
+		db->DestroyColumnFamilyHandle (delegators_handle);
+		std::erase_if (handles, [delegators_handle] (auto & handle) {
+			if (handle.get () == delegators_handle)
+			{
+				// The handle resource is deleted by RocksDB.
+				[[maybe_unused]] auto ptr = handle.release ();
+				return true;
+			}
+			return false;
+		});
+		transaction.refresh ();
+	}
+
+	{
+		logger.info (nano::log::type::rocksdb, "Creating table delegators");
+		::rocksdb::ColumnFamilyOptions new_cf_options;
+		::rocksdb::ColumnFamilyHandle * new_cf_handle;
+		::rocksdb::Status status = db->CreateColumnFamily (new_cf_options, "delegators", &new_cf_handle);
+		release_assert (success (status.code ()));
+		handles.emplace_back (new_cf_handle);
+		transaction.refresh ();
+	}
+
+	// Small batches in dev builds so that upgrade tests go through the periodic refresh as well
+	const size_t batch_size = nano::is_dev_run () ? 64 : 250000;
+
+	size_t processed = 0;
+	{
+		auto read_transaction = tx_begin_read ();
+		for (auto it = account.begin (read_transaction), end = account.end (read_transaction); it != end; ++it)
+		{
+			delegator.put (transaction, it->second.representative, it->first);
+
+			processed++;
+			if (processed % batch_size == 0)
+			{
+				logger.info (nano::log::type::rocksdb, "Processed {} accounts", processed);
+				transaction.refresh (); // Refresh to prevent excessive memory usage
+			}
+		}
+	}
+
+	logger.info (nano::log::type::rocksdb, "Done processing {} accounts", processed);
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25 completed");
+}
+
 void nano::store::rocksdb::component::generate_tombstone_map ()
 {
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::blocks), std::forward_as_tuple (0, 25000));
@@ -386,7 +452,8 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 	::rocksdb::ColumnFamilyOptions cf_options;
 	if (cf_name_a != ::rocksdb::kDefaultColumnFamilyName)
 	{
-		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_table_options ()));
+		auto const table_config = get_table_config (cf_name_a);
+		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_table_options (table_config)));
 		cf_options.table_factory = table_factory;
 		// Size of each memtable (write buffer for this column family)
 		cf_options.write_buffer_size = rocksdb_config.write_cache * 1024 * 1024;
@@ -394,6 +461,27 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 	return cf_options;
 }
 
+nano::rocksdb_table_config nano::store::rocksdb::component::get_table_config (std::string const & cf_name_a) const
+{
+	if (cf_name_a == "blocks")
+	{
+		return rocksdb_config.blocks;
+	}
+	if (cf_name_a == "accounts")
+	{
+		return rocksdb_config.accounts;
+	}
+	if (cf_name_a == "pending")
+	{
+		return rocksdb_config.pending;
+	}
+	if (cf_name_a == "confirmation_height")
+	{
+		return rocksdb_config.confirmation_height;
+	}
+	return {};
+}
+
 std::vector<rocksdb::ColumnFamilyDescriptor> nano::store::rocksdb::component::create_column_families ()
 {
 	std::vector<::rocksdb::ColumnFamilyDescriptor> column_families;
@@ -493,6 +581,8 @@ rocksdb::ColumnFamilyHandle * nano::store::rocksdb::component::table_to_column_f
 			return get_column_family ("final_votes");
 		case tables::rep_weights:
 			return get_column_family ("rep_weights");
+		case tables::delegators:
+			return get_column_family ("delegators");
 		default:
 			release_assert (false);
 			return get_column_family ("");
@@ -554,6 +644,56 @@ void nano::store::rocksdb::component::flush_table (nano::tables table_a)
 	db->Flush (::rocksdb::FlushOptions{}, table_to_column_family (table_a));
 }
 
+std::vector<int> nano::store::rocksdb::component::get_multiple (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::rocksdb::db_val> const & keys_a, std::vector<nano::store::rocksdb::db_val> & values_a) const
+{
+	values_a.assign (keys_a.size (), nano::store::rocksdb::db_val{});
+	if (keys_a.empty ())
+	{
+		return {};
+	}
+
+	::rocksdb::ReadOptions options;
+	std::vector<::rocksdb::ColumnFamilyHandle *> handles (keys_a.size (), table_to_column_family (table_a));
+	std::vector<::rocksdb::Slice> keys;
+	keys.reserve (keys_a.size ());
+	for (auto const & key : keys_a)
+	{
+		keys.emplace_back (reinterpret_cast<char const *> (key.data ()), key.size ());
+	}
+	std::vector<std::string> values;
+	auto internals = rocksdb::tx (transaction_a);
+	auto statuses = std::visit ([&] (auto && ptr) {
+		using V = std::remove_cvref_t<decltype (ptr)>;
+		if constexpr (std::is_same_v<V, ::rocksdb::Transaction *>)
+		{
+			return ptr->MultiGet (options, handles, keys, &values);
+		}
+		else if constexpr (std::is_same_v<V, ::rocksdb::ReadOptions *>)
+		{
+			return db->MultiGet (*ptr, handles, keys, &values);
+		}
+		else
+		{
+			static_assert (sizeof (V) == 0, "Missing variant handler for type V");
+		}
+	},
+	internals);
+	release_assert (statuses.size () == keys_a.size ());
+
+	std::vector<int> result;
+	result.reserve (statuses.size ());
+	for (size_t i = 0; i < statuses.size (); ++i)
+	{
+		if (statuses[i].ok ())
+		{
+			values_a[i].buffer = std::make_shared<std::vector<uint8_t>> (values[i].begin (), values[i].end ());
+			values_a[i].convert_buffer_to_value ();
+		}
+		result.push_back (statuses[i].code ());
+	}
+	return result;
+}
+
 int nano::store::rocksdb::component::get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const
 {
 	::rocksdb::ReadOptions options;
@@ -667,6 +807,14 @@ uint64_t nano::store::rocksdb::component::count (store::transaction const & tran
 			++sum;
 		}
 	}
+	// Same as accounts, should only be used in tests and CLI commands
+	else if (table_a == tables::delegators)
+	{
+		for (auto i (delegator.begin (transaction_a)), n (delegator.end (transaction_a)); i != n; ++i)
+		{
+			++sum;
+		}
+	}
 	else
 	{
 		debug_assert (false);
@@ -744,7 +892,7 @@ rocksdb::Options nano::store::rocksdb::component::get_db_options ()
 	return db_options;
 }
 
-rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_options () const
+rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_options (nano::rocksdb_table_config const & table_config) const
 {
 	::rocksdb::BlockBasedTableOptions table_options;
 
@@ -757,11 +905,28 @@ rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_optio
 	table_options.format_version = 5;
 
 	// Block cache for reads
-	table_options.block_cache = ::rocksdb::NewLRUCache (rocksdb_config.read_cache * 1024 * 1024);
+	table_options.block_cache = shared_read_cache ? shared_read_cache : ::rocksdb::NewLRUCache (rocksdb_config.read_cache * 1024 * 1024);
+
+	table_options.block_size = table_config.block_size * 1024;
 
 	// Bloom filter to help with point reads. 10bits gives 1% false positive rate.
 	table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (10, false));
 
+	if (table_config.partitioned_filters)
+	{
+		// Two level index, only the top level index needs to stay in memory, partitions are loaded through the block cache
+		table_options.index_type = ::rocksdb::BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+		table_options.partition_filters = true;
+		table_options.cache_index_and_filter_blocks = true;
+		table_options.pin_top_level_index_and_filter = true;
+	}
+
+	if (table_config.pin_l0_filters)
+	{
+		table_options.cache_index_and_filter_blocks = true;
+		table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+	}
+
 	return table_options;
 }
 
@@ -776,7 +941,7 @@ void nano::store::rocksdb::component::on_flush (::rocksdb::FlushJobInfo const &
 
 std::vector<nano::tables> nano::store::rocksdb::component::all_tables () const
 {
-	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights };
+	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights, tables::delegators };
 }
 
 bool nano::store::rocksdb::component::copy_db (std::filesystem::path const & destination_path)
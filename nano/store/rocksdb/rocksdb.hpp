@@ -8,6 +8,7 @@
 #include <nano/store/rocksdb/account.hpp>
 #include <nano/store/rocksdb/block.hpp>
 #include <nano/store/rocksdb/confirmation_height.hpp>
+#include <nano/store/rocksdb/delegator.hpp>
 #include <nano/store/rocksdb/final_vote.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
 #include <nano/store/rocksdb/online_weight.hpp>
@@ -51,6 +52,7 @@ private:
 	nano::store::rocksdb::pruned pruned_store;
 	nano::store::rocksdb::version version_store;
 	nano::store::rocksdb::rep_weight rep_weight_store;
+	nano::store::rocksdb::delegator delegator_store;
 
 public:
 	friend class nano::store::rocksdb::account;
@@ -63,6 +65,7 @@ public:
 	friend class nano::store::rocksdb::pruned;
 	friend class nano::store::rocksdb::version;
 	friend class nano::store::rocksdb::rep_weight;
+	friend class nano::store::rocksdb::delegator;
 
 	explicit component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::rocksdb_config const & = nano::rocksdb_config{}, bool open_read_only = false);
 
@@ -75,6 +78,8 @@ public:
 
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a) const;
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const;
+	/** Looks up all keys with a single MultiGet call, results are returned in the order of the keys */
+	std::vector<int> get_multiple (store::transaction const &, tables, std::vector<nano::store::rocksdb::db_val> const & keys, std::vector<nano::store::rocksdb::db_val> & values) const;
 	int put (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val const & value_a);
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a);
 
@@ -98,6 +103,8 @@ private:
 	std::vector<std::unique_ptr<::rocksdb::ColumnFamilyHandle>> handles;
 	nano::rocksdb_config rocksdb_config;
 	unsigned const max_block_write_batch_num_m;
+	// Read cache used by all column families, null when each column family has its own cache
+	std::shared_ptr<::rocksdb::Cache> shared_read_cache;
 
 	class tombstone_info
 	{
@@ -137,10 +144,12 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
 
 	::rocksdb::Options get_db_options ();
-	::rocksdb::BlockBasedTableOptions get_table_options () const;
+	::rocksdb::BlockBasedTableOptions get_table_options (nano::rocksdb_table_config const &) const;
 	::rocksdb::ColumnFamilyOptions get_cf_options (std::string const & cf_name_a) const;
+	nano::rocksdb_table_config get_table_config (std::string const & cf_name_a) const;
 
 	void on_flush (::rocksdb::FlushJobInfo const &);
 	void flush_table (nano::tables table_a);
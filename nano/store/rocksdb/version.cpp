@@ -26,3 +26,30 @@ int nano::store::rocksdb::version::get (store::transaction const & transaction_a
 	}
 	return result;
 }
+
+void nano::store::rocksdb::version::cache_put (store::write_transaction const & transaction_a, nano::store::cache_snapshot const & snapshot_a)
+{
+	nano::uint256_union cache_key{ 2 };
+	auto data = snapshot_a.serialize ();
+	auto status = store.put (transaction_a, tables::meta, cache_key, nano::store::rocksdb::db_val{ data.size (), data.data () });
+	store.release_assert_success (status);
+}
+
+std::optional<nano::store::cache_snapshot> nano::store::rocksdb::version::cache_get (store::transaction const & transaction_a) const
+{
+	nano::uint256_union cache_key{ 2 };
+	nano::store::rocksdb::db_val data;
+	auto status = store.get (transaction_a, tables::meta, cache_key, data);
+	if (store.success (status))
+	{
+		return nano::store::cache_snapshot::deserialize (static_cast<uint8_t const *> (data.data ()), data.size ());
+	}
+	return std::nullopt;
+}
+
+void nano::store::rocksdb::version::cache_del (store::write_transaction const & transaction_a)
+{
+	nano::uint256_union cache_key{ 2 };
+	auto status = store.del (transaction_a, tables::meta, cache_key);
+	release_assert (store.success (status) || store.not_found (status));
+}
@@ -13,5 +13,8 @@ public:
 	explicit version (nano::store::rocksdb::component & store_a);
 	void put (store::write_transaction const & transaction_a, int version_a) override;
 	int get (store::transaction const & transaction_a) const override;
+	void cache_put (store::write_transaction const & transaction_a, nano::store::cache_snapshot const & snapshot_a) override;
+	std::optional<nano::store::cache_snapshot> cache_get (store::transaction const & transaction_a) const override;
+	void cache_del (store::write_transaction const & transaction_a) override;
 };
 } // namespace nano::store::rocksdb
@@ -21,6 +21,11 @@ nano::store::read_transaction_impl::read_transaction_impl (nano::id_dispenser::i
 {
 }
 
+std::chrono::milliseconds nano::store::read_transaction_impl::max_staleness () const
+{
+	return std::chrono::milliseconds{ 500 };
+}
+
 /*
  * write_transaction_impl
  */
@@ -83,10 +88,10 @@ void nano::store::read_transaction::refresh ()
 	renew ();
 }
 
-bool nano::store::read_transaction::refresh_if_needed (std::chrono::milliseconds max_age)
+bool nano::store::read_transaction::refresh_if_needed (std::optional<std::chrono::milliseconds> max_age)
 {
 	auto now = std::chrono::steady_clock::now ();
-	if (now - start > max_age)
+	if (now - start > max_age.value_or (impl->max_staleness ()))
 	{
 		refresh ();
 		return true;
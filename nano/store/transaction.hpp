@@ -3,7 +3,9 @@
 #include <nano/lib/id_dispenser.hpp>
 #include <nano/store/tables.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 namespace nano::store
 {
@@ -23,6 +25,8 @@ public:
 	explicit read_transaction_impl (nano::id_dispenser::id_t const store_id = 0);
 	virtual void reset () = 0;
 	virtual void renew () = 0;
+	/** Age after which `read_transaction::refresh_if_needed ()` renews the snapshot */
+	virtual std::chrono::milliseconds max_staleness () const;
 };
 
 class write_transaction_impl : public transaction_impl
@@ -66,7 +70,8 @@ public:
 	void reset ();
 	void renew ();
 	void refresh ();
-	bool refresh_if_needed (std::chrono::milliseconds max_age = std::chrono::milliseconds{ 500 });
+	/** Refreshes the transaction if it is older than `max_age`, or the store's maximum staleness when not given */
+	bool refresh_if_needed (std::optional<std::chrono::milliseconds> max_age = std::nullopt);
 
 private:
 	std::unique_ptr<read_transaction_impl> impl;
@@ -1 +1,78 @@
+#include <nano/crypto/blake2/blake2.h>
+#include <nano/lib/stream.hpp>
 #include <nano/store/version.hpp>
+
+namespace
+{
+uint64_t checksum (uint8_t const * data, std::size_t size)
+{
+	uint64_t result;
+	blake2b_state state;
+	blake2b_init (&state, sizeof (result));
+	blake2b_update (&state, data, size);
+	blake2b_final (&state, reinterpret_cast<uint8_t *> (&result), sizeof (result));
+	return result;
+}
+}
+
+std::vector<uint8_t> nano::store::cache_snapshot::serialize () const
+{
+	std::vector<uint8_t> result;
+	{
+		nano::vectorstream stream (result);
+		nano::write (stream, format_current);
+		nano::write (stream, static_cast<uint32_t> (store_version));
+		nano::write (stream, node_major_version);
+		nano::write (stream, node_minor_version);
+		nano::write (stream, block_count);
+		nano::write (stream, account_count);
+		nano::write (stream, cemented_count);
+		nano::write (stream, pruned_count);
+	}
+	auto const sum = checksum (result.data (), result.size ());
+	{
+		nano::vectorstream stream (result);
+		nano::write (stream, sum);
+	}
+	return result;
+}
+
+std::optional<nano::store::cache_snapshot> nano::store::cache_snapshot::deserialize (uint8_t const * data, std::size_t size)
+{
+	if (size < sizeof (uint64_t))
+	{
+		return std::nullopt;
+	}
+	auto const body_size = size - sizeof (uint64_t);
+	uint64_t sum;
+	std::copy (data + body_size, data + size, reinterpret_cast<uint8_t *> (&sum));
+	if (sum != checksum (data, body_size))
+	{
+		return std::nullopt;
+	}
+
+	nano::bufferstream stream (data, body_size);
+	nano::store::cache_snapshot result;
+	uint8_t format;
+	uint32_t store_version;
+	auto error = nano::try_read (stream, format) || format != format_current;
+	error = error || nano::try_read (stream, store_version);
+	error = error || nano::try_read (stream, result.node_major_version);
+	error = error || nano::try_read (stream, result.node_minor_version);
+	error = error || nano::try_read (stream, result.block_count);
+	error = error || nano::try_read (stream, result.account_count);
+	error = error || nano::try_read (stream, result.cemented_count);
+	error = error || nano::try_read (stream, result.pruned_count);
+	if (error)
+	{
+		return std::nullopt;
+	}
+	result.store_version = static_cast<int> (store_version);
+	return result;
+}
+
+bool nano::store::cache_snapshot::valid () const
+{
+	// Every account has at least one block and the genesis block is always cemented
+	return account_count > 0 && account_count <= block_count && cemented_count > 0 && cemented_count <= block_count;
+}
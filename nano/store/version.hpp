@@ -3,7 +3,10 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/store/component.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -12,12 +15,42 @@ class block_hash;
 namespace nano::store
 {
 /**
- * Manages version storage
+ * Ledger cache counts, persisted on clean shutdown so that they don't need to be recomputed by scanning the ledger at startup
+ */
+class cache_snapshot
+{
+public:
+	// Increment when the record layout or the meaning of the counts changes, records of any other format are ignored
+	static uint8_t constexpr format_current = 1;
+
+	// Versions of the store schema and of the node that took the snapshot, it is only used by the same versions
+	int store_version{ 0 };
+	uint8_t node_major_version{ 0 };
+	uint8_t node_minor_version{ 0 };
+
+	uint64_t block_count{ 0 };
+	uint64_t account_count{ 0 };
+	uint64_t cemented_count{ 0 };
+	uint64_t pruned_count{ 0 };
+
+	// The record ends with a checksum of its contents
+	std::vector<uint8_t> serialize () const;
+	// Returns nothing for records of another format, truncated records or records that fail the checksum
+	static std::optional<cache_snapshot> deserialize (uint8_t const * data, std::size_t size);
+	// Cheap consistency checks of the stored counts
+	bool valid () const;
+};
+
+/**
+ * Manages version storage and other meta information about the block store
  */
 class version
 {
 public:
 	virtual void put (store::write_transaction const &, int) = 0;
 	virtual int get (store::transaction const &) const = 0;
+	virtual void cache_put (store::write_transaction const &, nano::store::cache_snapshot const &) = 0;
+	virtual std::optional<nano::store::cache_snapshot> cache_get (store::transaction const &) const = 0;
+	virtual void cache_del (store::write_transaction const &) = 0;
 };
 } // namespace nano::store